@@ -6,6 +6,8 @@ using EpicGames.Core;
 using UnrealBuildBase;
 using Microsoft.Extensions.Logging;
 using System;
+using System.IO;
+using System.Text;
 
 public class BuildTimeIncludeTarget : TargetRules
 {
@@ -25,7 +27,47 @@ public class BuildTimeIncludeTarget : TargetRules
         // Set to false if you don't need the version checking to be strict.
         bWarningsAsErrors = true;
 
-        BuildTimeIncludeTarget.ConfigureGameFeaturePlugins(Target, Logger, ProjectFile, DisablePlugins, EnablePlugins);
+        BuildTimeIncludeTarget.ConfigureGameFeaturePlugins(Target, Type, Logger, ProjectFile, DisablePlugins, EnablePlugins);
+        BuildTimeIncludeTarget.WriteReleaseVersionHeader(Target, Type, Logger, ProjectFile);
+    }
+
+    // Name of the header WriteReleaseVersionHeader generates, included through ExampleCompiledVersion.h
+    public const string ReleaseVersionHeaderName = "ExampleReleaseVersionGenerated.h";
+
+    // Per-target directory of the generated header. BuildTimeInclude.Build.cs adds it to the include paths.
+    public static DirectoryReference GetReleaseVersionHeaderDirectory(DirectoryReference ProjectDirectory, string TargetName)
+    {
+        return DirectoryReference.Combine(ProjectDirectory, "Intermediate", "BuildTimeInclude", TargetName);
+    }
+
+    // Write the target release version as a C++ header, so game code can compile out features the release doesn't include.
+    // Editor targets turn version gating off, the editor has to keep every feature to author and cook content for any release.
+    public static void WriteReleaseVersionHeader(TargetInfo Target, TargetType Type, ILogger Logger, FileReference ProjectFile)
+    {
+        ReleaseVersion TargetVersion;
+        GetTargetReleaseVersion(Logger, ProjectFile, out TargetVersion);
+        bool bVersionGating = Type != TargetType.Editor;
+
+        string Contents = String.Join(Environment.NewLine,
+            "// Generated by BuildTimeInclude.Target.cs from the target release version. Do not edit, do not include directly: use ExampleCompiledVersion.h.",
+            "",
+            "#pragma once",
+            "",
+            String.Format("#define EXAMPLE_COMPILED_RELEASE_VERSION_MAJOR {0}", TargetVersion.MajorVersion),
+            String.Format("#define EXAMPLE_COMPILED_RELEASE_VERSION_MINOR {0}", TargetVersion.MinorVersion),
+            String.Format("#define EXAMPLE_COMPILED_VERSION_GATING {0}", bVersionGating ? 1 : 0),
+            "");
+
+        // Only touch the file when its contents change, otherwise every build would recompile everything including it
+        DirectoryReference HeaderDir = GetReleaseVersionHeaderDirectory(ProjectFile.Directory, Target.Name);
+        FileReference HeaderFile = FileReference.Combine(HeaderDir, ReleaseVersionHeaderName);
+        if (!FileReference.Exists(HeaderFile) || FileReference.ReadAllText(HeaderFile) != Contents)
+        {
+            DirectoryReference.CreateDirectory(HeaderDir);
+            FileReference.WriteAllText(HeaderFile, Contents);
+            Logger.LogInformation("Wrote {Arg0} for release version v{Arg1}.{Arg2}, version gating {Arg3}",
+                HeaderFile, TargetVersion.MajorVersion, TargetVersion.MinorVersion, bVersionGating ? "on" : "off");
+        }
     }
 
     // Struct to parse release version into with CommandLine.ParseArguments
@@ -70,6 +112,165 @@ public class BuildTimeIncludeTarget : TargetRules
         }
     }
 
+    // Reader and writer for the inclusion manifest, see FExampleInclusionManifest for the layout. UBT owns the plugin section
+    // and carries the cooker's asset section over as opaque bytes.
+    public class InclusionManifest
+    {
+        public const uint FileMagic = 0x4D495845; // 'EXIM'
+        public const uint FileVersion = 2;
+
+        public class PluginDecision
+        {
+            public string Name;
+            public ulong DescriptorHash;
+            public ReleaseVersion IntroVersion;
+            public bool bHasSunsetVersion;
+            public ReleaseVersion SunsetVersion;
+            // Included at the target release version
+            public bool bIncluded;
+            // Enabled in the build, because it's included at the target release version or within the live ops window
+            public bool bShipped;
+
+            // Whether the range [IntroVersion, SunsetVersion) includes any version from TargetVersion up to and including
+            // LiveOpsMaxVersion. Without a live ops window only the target release version counts.
+            public bool IsIncludedUpTo(ReleaseVersion TargetVersion, ReleaseVersion LiveOpsMaxVersion)
+            {
+                if (bIncluded)
+                {
+                    return true;
+                }
+                return LiveOpsMaxVersion != null && ReleaseVersion.Compare(IntroVersion, LiveOpsMaxVersion) >= 0
+                    && (!bHasSunsetVersion || ReleaseVersion.Compare(TargetVersion, SunsetVersion) > 0);
+            }
+        }
+
+        public ReleaseVersion Version;
+        public List<PluginDecision> Plugins = new List<PluginDecision>();
+        public byte[] AssetSection = new byte[0];
+
+        // Path of the manifest inside the staged build, relative to the project directory. Must match FExampleInclusionManifest::GetDefaultFilename.
+        public const string StagedPath = "ExampleInclusion/InclusionManifest.bin";
+
+        // Working copy shared by UBT and the cooker. Under Saved so builds and cooks don't modify checked-in files,
+        // BuildTimeInclude.Build.cs stages it from there.
+        public static FileReference GetDefaultFile(DirectoryReference ProjectDirectory)
+        {
+            return FileReference.Combine(ProjectDirectory, "Saved", "ExampleInclusion", "InclusionManifest.bin");
+        }
+
+        // FNV-1a 64, same as the C++ side
+        public static ulong Hash(byte[] Bytes)
+        {
+            ulong Result = 0xcbf29ce484222325;
+            foreach (byte Byte in Bytes)
+            {
+                Result = (Result ^ Byte) * 0x100000001b3;
+            }
+            return Result;
+        }
+
+        public PluginDecision FindPlugin(string Name)
+        {
+            return Plugins.Find(Plugin => String.Equals(Plugin.Name, Name, StringComparison.OrdinalIgnoreCase));
+        }
+
+        // Returns null if the file is missing or unreadable
+        public static InclusionManifest Read(FileReference File)
+        {
+            if (!FileReference.Exists(File))
+            {
+                return null;
+            }
+
+            try
+            {
+                using (BinaryReader Reader = new BinaryReader(new MemoryStream(FileReference.ReadAllBytes(File)), Encoding.UTF8))
+                {
+                    if (Reader.ReadUInt32() != FileMagic || Reader.ReadUInt32() != FileVersion)
+                    {
+                        return null;
+                    }
+
+                    InclusionManifest Manifest = new InclusionManifest();
+                    Manifest.Version = ReadVersion(Reader);
+                    int NumPlugins = Reader.ReadInt32();
+                    for (int Index = 0; Index < NumPlugins; ++Index)
+                    {
+                        PluginDecision Plugin = new PluginDecision();
+                        Plugin.Name = Encoding.UTF8.GetString(Reader.ReadBytes(Reader.ReadInt32()));
+                        Plugin.DescriptorHash = Reader.ReadUInt64();
+                        Plugin.IntroVersion = ReadVersion(Reader);
+                        Plugin.bHasSunsetVersion = Reader.ReadByte() != 0;
+                        Plugin.SunsetVersion = ReadVersion(Reader);
+                        Plugin.bIncluded = Reader.ReadByte() != 0;
+                        Plugin.bShipped = Reader.ReadByte() != 0;
+                        Manifest.Plugins.Add(Plugin);
+                    }
+                    Manifest.AssetSection = Reader.ReadBytes((int)Reader.ReadInt64());
+                    return Manifest;
+                }
+            }
+            catch (Exception)
+            {
+                return null;
+            }
+        }
+
+        public byte[] ToBytes()
+        {
+            using (MemoryStream Stream = new MemoryStream())
+            {
+                using (BinaryWriter Writer = new BinaryWriter(Stream, Encoding.UTF8))
+                {
+                    Writer.Write(FileMagic);
+                    Writer.Write(FileVersion);
+                    WriteVersion(Writer, Version);
+                    Writer.Write(Plugins.Count);
+                    foreach (PluginDecision Plugin in Plugins)
+                    {
+                        byte[] NameBytes = Encoding.UTF8.GetBytes(Plugin.Name);
+                        Writer.Write(NameBytes.Length);
+                        Writer.Write(NameBytes);
+                        Writer.Write(Plugin.DescriptorHash);
+                        WriteVersion(Writer, Plugin.IntroVersion);
+                        Writer.Write((byte)(Plugin.bHasSunsetVersion ? 1 : 0));
+                        WriteVersion(Writer, Plugin.SunsetVersion);
+                        Writer.Write((byte)(Plugin.bIncluded ? 1 : 0));
+                        Writer.Write((byte)(Plugin.bShipped ? 1 : 0));
+                    }
+                    Writer.Write((long)AssetSection.Length);
+                    Writer.Write(AssetSection);
+                }
+                return Stream.ToArray();
+            }
+        }
+
+        // Only touches the file when its contents change
+        public void Write(FileReference File)
+        {
+            byte[] Bytes = ToBytes();
+            if (FileReference.Exists(File) && FileReference.ReadAllBytes(File).AsSpan().SequenceEqual(Bytes))
+            {
+                return;
+            }
+            DirectoryReference.CreateDirectory(File.Directory);
+            FileReference.WriteAllBytes(File, Bytes);
+        }
+
+        private static ReleaseVersion ReadVersion(BinaryReader Reader)
+        {
+            int Major = Reader.ReadInt32();
+            return new ReleaseVersion(Major, Reader.ReadInt32());
+        }
+
+        // Missing versions are written like the C++ default sunset version
+        private static void WriteVersion(BinaryWriter Writer, ReleaseVersion Version)
+        {
+            Writer.Write(Version != null ? Version.MajorVersion : 99999);
+            Writer.Write(Version != null ? Version.MinorVersion : 0);
+        }
+    }
+
     // Try to get release version from the -ExampleReleaseVersion commandline argument.
     // Not very compatible with RunUAT because it doesn't pass arguments onto the cook step.
     public static bool GetReleaseVersionFromCommandLine(ILogger Logger, out ReleaseVersion Version)
@@ -149,13 +350,51 @@ public class BuildTimeIncludeTarget : TargetRules
         }
     }
 
+    // Get the last release version live ops may switch a build to, from DefaultGame.ini [MyGame] ExampleLiveOpsMaxVersion.
+    // Null if it's missing or empty, then only the plugins of the target release version ship.
+    public static ReleaseVersion GetLiveOpsMaxVersion(ILogger Logger, FileReference ProjectFile, ReleaseVersion TargetVersion)
+    {
+        FileReference GameIni = FileReference.Combine(ProjectFile.Directory, "Config", "DefaultGame.ini");
+        ConfigFile GameConfigFile = new ConfigFile(GameIni);
+        ConfigFileSection MyGameSection;
+        ConfigLine LiveOpsMaxVersionLine;
+        if (!GameConfigFile.TryGetSection("MyGame", out MyGameSection) ||
+            !MyGameSection.TryGetLine("ExampleLiveOpsMaxVersion", out LiveOpsMaxVersionLine) ||
+            String.IsNullOrWhiteSpace(LiveOpsMaxVersionLine.Value))
+        {
+            return null;
+        }
+
+        ReleaseVersion MaxVersion;
+        try
+        {
+            MaxVersion = ReleaseVersion.Parse(LiveOpsMaxVersionLine.Value);
+        }
+        catch
+        {
+            MaxVersion = null;
+        }
+        if (MaxVersion == null)
+        {
+            Logger.LogError("Failed to parse ExampleLiveOpsMaxVersion {Arg0} into Major and Minor number.", LiveOpsMaxVersionLine.Value);
+            throw new BuildException("Failed in GetLiveOpsMaxVersion()");
+        }
+        if (ReleaseVersion.Compare(TargetVersion, MaxVersion) < 0)
+        {
+            Logger.LogWarning("ExampleLiveOpsMaxVersion v{Arg0}.{Arg1} is before the release version, ignoring it.", MaxVersion.MajorVersion, MaxVersion.MinorVersion);
+            return null;
+        }
+        return MaxVersion;
+    }
+
     // Get the target release version, prioritizing environment var, then Config
     public static bool GetTargetReleaseVersion(ILogger Logger, FileReference ProjectFile, out ReleaseVersion Version)
     {
         return GetReleaseVersionFromEnvVar(Logger, out Version) || GetReleaseVersionFromConfig(Logger, ProjectFile, out Version);
     }
 
-    public static void ConfigureGameFeaturePlugins(TargetInfo Target, ILogger Logger, FileReference ProjectFile, List<string> OutDisablePlugins, List<string> OutEnablePlugins)
+    // Only game targets write the inclusion manifest, editor targets make the same plugin decisions but don't ship them
+    public static void ConfigureGameFeaturePlugins(TargetInfo Target, TargetType Type, ILogger Logger, FileReference ProjectFile, List<string> OutDisablePlugins, List<string> OutEnablePlugins)
     {
         // Parse release version for this build. Command line argument takes precedence, otherwise use DefaultGame.ini ProjectVersion
         ReleaseVersion TargetVersion;
@@ -163,6 +402,25 @@ public class BuildTimeIncludeTarget : TargetRules
         Logger.LogInformation("Evaluating GameFeaturePlugins based on release version v{Arg0}.{Arg1} and configuration {Arg2}",
             TargetVersion.MajorVersion, TargetVersion.MinorVersion, Target.Configuration.ToString());
 
+        // Plugins included at any version of the live ops window ship too, so the game can switch to them at runtime
+        ReleaseVersion LiveOpsMaxVersion = GetLiveOpsMaxVersion(Logger, ProjectFile, TargetVersion);
+        if (LiveOpsMaxVersion != null)
+        {
+            Logger.LogInformation("Shipping GameFeaturePlugins included up to live ops version v{Arg0}.{Arg1}", LiveOpsMaxVersion.MajorVersion, LiveOpsMaxVersion.MinorVersion);
+        }
+
+        // Decisions of the previous build are reused for unchanged descriptors, as long as they were made for the same release version.
+        // Asset decisions the cooker recorded for that version are carried over.
+        FileReference ManifestFile = InclusionManifest.GetDefaultFile(ProjectFile.Directory);
+        InclusionManifest PreviousManifest = InclusionManifest.Read(ManifestFile);
+        if (PreviousManifest != null && ReleaseVersion.Compare(PreviousManifest.Version, TargetVersion) != 0)
+        {
+            PreviousManifest = null;
+        }
+        InclusionManifest Manifest = new InclusionManifest();
+        Manifest.Version = TargetVersion;
+        Manifest.AssetSection = PreviousManifest != null ? PreviousManifest.AssetSection : new byte[0];
+
         // We will explore the Plugins/GameFeatures folder
         DirectoryReference GameFeaturePluginsDir = DirectoryReference.Combine(Target.ProjectFile.Directory, "Plugins", "GameFeatures");
         if (DirectoryReference.Exists(GameFeaturePluginsDir))
@@ -177,6 +435,25 @@ public class BuildTimeIncludeTarget : TargetRules
 
                 string PluginName = PluginFile.GetFileNameWithoutExtension();
                 bool bEnabled = false;
+
+                // Skip parsing descriptors that didn't change since the decision was recorded
+                ulong DescriptorHash = InclusionManifest.Hash(FileReference.ReadAllBytes(PluginFile));
+                InclusionManifest.PluginDecision PreviousDecision = PreviousManifest != null ? PreviousManifest.FindPlugin(PluginName) : null;
+                if (PreviousDecision != null && PreviousDecision.DescriptorHash == DescriptorHash)
+                {
+                    // The live ops window may have changed since, it only needs the recorded range
+                    PreviousDecision.bShipped = PreviousDecision.IsIncludedUpTo(TargetVersion, LiveOpsMaxVersion);
+                    bEnabled = PreviousDecision.bShipped;
+                    Manifest.Plugins.Add(PreviousDecision);
+                    Logger.LogInformation("GameFeaturePlugin {Arg0} unchanged, reusing decision from inclusion manifest. Outcome = {Arg1}, included at release version = {Arg2}",
+                        PluginName, bEnabled, PreviousDecision.bIncluded);
+                    if (bEnabled)
+                    {
+                        OutEnablePlugins.Add(PluginName);
+                    }
+                    continue;
+                }
+
                 try
                 {
                     // Parse uplugin file as JsonObject, which we'll use to parse our custom versioning values. 
@@ -233,6 +510,23 @@ public class BuildTimeIncludeTarget : TargetRules
                     {
                         Logger.LogWarning("GameFeaturePlugin {Arg0} did NOT pass release version checks.", PluginName);
                     }
+
+                    // Only descriptors that parsed are recorded, broken ones are parsed and reported again on the next build
+                    InclusionManifest.PluginDecision Decision = new InclusionManifest.PluginDecision();
+                    Decision.Name = PluginName;
+                    Decision.DescriptorHash = DescriptorHash;
+                    Decision.IntroVersion = IntroVersion;
+                    Decision.bHasSunsetVersion = bHasSunsetVersion;
+                    Decision.SunsetVersion = SunsetVersion;
+                    Decision.bIncluded = bEnabled;
+                    Decision.bShipped = Decision.IsIncludedUpTo(TargetVersion, LiveOpsMaxVersion);
+                    Manifest.Plugins.Add(Decision);
+
+                    if (Decision.bShipped && !Decision.bIncluded)
+                    {
+                        Logger.LogWarning("GameFeaturePlugin {Arg0} is included within the live ops window, enabling it without activating it at startup.", PluginName);
+                        bEnabled = true;
+                    }
                 }
                 catch (Exception ParseException)
                 {
@@ -253,5 +547,10 @@ public class BuildTimeIncludeTarget : TargetRules
         {
             Logger.LogWarning("Enabled plugin: {Arg1}", PluginName);
         }
+
+        if (Type != TargetType.Editor)
+        {
+            Manifest.Write(ManifestFile);
+        }
     }
 }
@@ -1,5 +1,6 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class BuildTimeInclude : ModuleRules
@@ -12,6 +13,16 @@ public class BuildTimeInclude : ModuleRules
 
 		PrivateDependencyModuleNames.AddRange(new string[] { "Json", "JsonUtilities", "GameFeatures", "ModularGameplay" });
 
+		// Release version header generated by the target, see BuildTimeIncludeTarget.WriteReleaseVersionHeader and ExampleCompiledVersion.h
+		PublicIncludePaths.Add(Path.Combine(Target.ProjectFile.Directory.FullName, "Intermediate", "BuildTimeInclude", Target.Name));
+
+		// Inclusion manifest written by the target and the cooker under Saved, staged into the build, see FExampleInclusionManifest::GetDefaultFilename
+		if (Target.Type != TargetType.Editor)
+		{
+			RuntimeDependencies.Add(Path.Combine("$(ProjectDir)", BuildTimeIncludeTarget.InclusionManifest.StagedPath),
+				BuildTimeIncludeTarget.InclusionManifest.GetDefaultFile(Target.ProjectFile.Directory).FullName, StagedFileType.UFS);
+		}
+
 		// Uncomment if you are using Slate UI
 		// PrivateDependencyModuleNames.AddRange(new string[] { "Slate", "SlateCore" });
 		
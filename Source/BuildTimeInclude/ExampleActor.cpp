@@ -2,6 +2,8 @@
 
 #include "ExampleActor.h"
 #include "ExampleAssetManager.h"
+#include "ExampleVersionGatingTrace.h"
+#include "ExampleReceiverRegistrationSubsystem.h"
 #include "Components/GameFrameworkComponentManager.h"
 
 AExampleActor::AExampleActor()
@@ -17,6 +19,16 @@ FPrimaryAssetId AExampleActor::GetPrimaryAssetId() const
 	return MyId;
 }
 
+void AExampleActor::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
+{
+	Super::GetAssetRegistryTags(OutTags);
+
+	if (FAssetRegistryTag* VersionRangeTag = OutTags.FindByPredicate([](const FAssetRegistryTag& Tag) { return Tag.Name == FExampleVersionRange::AssetTagName; }))
+	{
+		VersionRangeTag->Value = FExampleVersionRange::ToAssetTagValue(VersionRange);
+	}
+}
+
 void AExampleActor::BeginPlay()
 {
 	Super::BeginPlay();
@@ -25,7 +37,13 @@ void AExampleActor::BeginPlay()
 	// Register ourselves with the modular gameplay manager. This will now add components to this actor when
 	// a GameFeaturePlugin specifies it. For example: this ensures hats are loaded if (and only if) the 
 	// ExampleGameFeaturePlugin was cooked and packaged as part of a build's release version.
-	if (UGameFrameworkComponentManager* ComponentManager = GetGameInstance()->GetSubsystem<UGameFrameworkComponentManager>())
+	// Registration goes through UExampleReceiverRegistrationSubsystem, which spreads it over several frames when many
+	// actors begin play at once.
+	if (UExampleReceiverRegistrationSubsystem* ReceiverRegistration = UWorld::GetSubsystem<UExampleReceiverRegistrationSubsystem>(GetWorld()))
+	{
+		ReceiverRegistration->AddReceiver(this);
+	}
+	else if (UGameFrameworkComponentManager* ComponentManager = GetGameInstance()->GetSubsystem<UGameFrameworkComponentManager>())
 	{
 		ComponentManager->AddReceiver(this);
 	}
@@ -34,6 +52,7 @@ void AExampleActor::BeginPlay()
 #if WITH_EDITOR
 void AExampleActor::PostLoad()
 {
+	EXAMPLE_VERSION_GATING_SCOPE(AExampleActor_PostLoad);
 	Super::PostLoad();
 
 	// If cooking and target release version excludes this class, mark self as transient so the object won't be saved.
@@ -43,12 +62,14 @@ void AExampleActor::PostLoad()
 	if (IsRunningCookCommandlet() && !UExampleAssetManager::DoesVersionRangeInclude(VersionRange))
 	{
 		SetFlags(EObjectFlags::RF_Transient);
+		EXAMPLE_VERSION_GATING_COUNTER_ADD(ActorsMarkedTransient, 1);
 		UE_LOG(LogTemp, Warning, TEXT("Actor '%s' of type '%s' marking self as transient to avoid save"), *GetPathName(), *GetClass()->GetName());
 	}
 }
 
 void AExampleActor::PreSave(FObjectPreSaveContext ObjectSaveContext)
 {
+	EXAMPLE_VERSION_GATING_SCOPE(AExampleActor_PreSave);
 	Super::PreSave(ObjectSaveContext);
 
 	if (ObjectSaveContext.IsCooking())
@@ -20,6 +20,9 @@ public:
 	// Return an id with custom PrimaryAssetType that asset manager will look for
 	virtual FPrimaryAssetId GetPrimaryAssetId() const override;
 
+	// Replace the struct text AssetRegistrySearchable writes for VersionRange with the compact tag value
+	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+
 	// If a level contains this actor, you will see a message logged at BeginPlay. In the standalone build, check for the message.
 	virtual void BeginPlay() override;
 
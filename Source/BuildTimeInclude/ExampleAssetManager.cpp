@@ -1,11 +1,33 @@
 // Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
 
 #include "ExampleAssetManager.h"
+#include "ExampleCompiledVersion.h"
+#include "ExampleVersionRangeCache.h"
+#include "ExampleVersionMatrix.h"
+#include "ExampleInclusionDecisionCache.h"
+#include "ExampleInclusionJournal.h"
+#include "ExampleVersionChunks.h"
+#include "ExampleInclusionValidation.h"
+#include "ExampleVersionGatingTrace.h"
+#include "ExampleCookDecisionTable.h"
+#include "Misc/FileHelper.h"
+#include "Algo/Count.h"
+#include "Async/ParallelFor.h"
+
+#include <atomic>
 
 #if PLATFORM_WINDOWS
 #include "Windows/WindowsPlatformMisc.h"
 #endif
 
+namespace ExampleReleaseVersionContext
+{
+	// Packed key of the resolved release version. The minimum packed key (vMIN_int32.MIN_int32) marks it as not resolved yet.
+	static constexpr uint64 UnresolvedPackedVersion = 0;
+	static std::atomic<uint64> ResolvedPackedVersion{ UnresolvedPackedVersion };
+	static FCriticalSection ResolveCriticalSection;
+}
+
 bool UExampleAssetManager::TryParseReleaseVersion(const FString& StringValue, FExampleVersion& OutReleaseVersion)
 {
 	if (!StringValue.IsEmpty())
@@ -65,6 +87,45 @@ bool UExampleAssetManager::TryGetReleaseVersionFromCommandLine(FExampleVersion&
 	return false;
 }
 
+bool UExampleAssetManager::TryGetReleaseVersionFromCookDirector(FExampleVersion& OutReleaseVersion)
+{
+	// Cook workers use the version their director decided with, whatever their own command line or environment says
+	if (FExampleCookDecisionTable::IsCookWorker())
+	{
+		FExampleVersion ReleaseVersion;
+		FGuid SessionId;
+		if (!FExampleCookDecisionTable::TryReadReleaseVersion(FExampleCookDecisionTable::GetDefaultFilename(), ReleaseVersion, SessionId))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Cook worker failed to read the cook director's decision table '%s'."), *FExampleCookDecisionTable::GetDefaultFilename());
+		}
+		else if (!SessionId.IsValid() || SessionId != FExampleCookDecisionTable::GetDirectorSessionId())
+		{
+			UE_LOG(LogTemp, Error, TEXT("Cook decision table '%s' was written by cook session %s, not by this worker's director (session %s)."),
+				*FExampleCookDecisionTable::GetDefaultFilename(), *SessionId.ToString(), *FExampleCookDecisionTable::GetDirectorSessionId().ToString());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Log, TEXT("Parsed release version %s from cook director's decision table."), *ReleaseVersion.ToString());
+			OutReleaseVersion = ReleaseVersion;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UExampleAssetManager::TryGetReleaseVersionFromManifest(FExampleVersion& OutReleaseVersion)
+{
+	// The inclusion manifest records the version a packaged build was made for
+	if (FExampleInclusionManifest::TryReadReleaseVersion(FExampleInclusionManifest::GetDefaultFilename(), OutReleaseVersion))
+	{
+		UE_LOG(LogTemp, Log, TEXT("Parsed release version %s from inclusion manifest."), *OutReleaseVersion.ToString());
+		return true;
+	}
+
+	return false;
+}
+
 bool UExampleAssetManager::TryGetReleaseVersionFromConfig(FExampleVersion& OutReleaseVersion)
 {
 	// Retrieve release version from DefaultGame.ini and treat as release version.
@@ -95,13 +156,21 @@ bool UExampleAssetManager::TryGetReleaseVersionFromConfig(FExampleVersion& OutRe
  */
 FExampleVersion UExampleAssetManager::GetReleaseVersion()
 {
-	static bool bVersionCached = false;
-	static FExampleVersion CachedVersion;
+	using namespace ExampleReleaseVersionContext;
 
-	// If version was cached before, return it now
-	if (bVersionCached)
+	// Once resolved, the version is a single atomic load. Safe to call from the async loading thread and any worker thread.
+	uint64 PackedVersion = ResolvedPackedVersion.load(std::memory_order_acquire);
+	if (PackedVersion != UnresolvedPackedVersion)
 	{
-		return CachedVersion;
+		return FExampleVersion::FromPackedKey(PackedVersion);
+	}
+
+	// Only the first callers serialize here, whoever gets the lock first resolves the version for everyone
+	FScopeLock Lock(&ResolveCriticalSection);
+	PackedVersion = ResolvedPackedVersion.load(std::memory_order_relaxed);
+	if (PackedVersion != UnresolvedPackedVersion)
+	{
+		return FExampleVersion::FromPackedKey(PackedVersion);
 	}
 
 	FExampleVersion OutVersion;
@@ -109,78 +178,442 @@ FExampleVersion UExampleAssetManager::GetReleaseVersion()
 	// Try getting the version info from various sources in order of priority. If you supply the version info from command-line, be aware
 	// that UAT doesn't automatically forward original cmd args to the command of each build step, so it's limitedly useful unless you
 	// manually trigger the build step commands or modify UAT. Env vars are quickest to get external values working, while command line
-	// can be useful if you are able to customize build tools.
-	if (TryGetReleaseVersionFromCommandLine(OutVersion) || TryGetReleaseVersionFromEnvVar(OutVersion) || TryGetReleaseVersionFromConfig(OutVersion))
+	// can be useful if you are able to customize build tools. Cooked builds take the version they were cooked for from the
+	// inclusion manifest instead of re-resolving it.
+	if (TryGetReleaseVersionFromCookDirector(OutVersion) || TryGetReleaseVersionFromCommandLine(OutVersion) || (FPlatformProperties::RequiresCookedData() && TryGetReleaseVersionFromManifest(OutVersion))
+		|| TryGetReleaseVersionFromEnvVar(OutVersion) || TryGetReleaseVersionFromConfig(OutVersion))
 	{
-		CachedVersion = OutVersion;
-		bVersionCached = true;
-		return CachedVersion;
+		// Code compiled out through ExampleCompiledVersion.h follows the version the target was built for, not this one
+		if (ExampleCompiledVersion::bVersionGating && OutVersion != ExampleCompiledVersion::ReleaseVersion)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Release version %s differs from version %s the code was compiled for."), *OutVersion.ToString(), *ExampleCompiledVersion::ReleaseVersion.ToString());
+		}
+		ResolvedPackedVersion.store(OutVersion.GetPackedKey(), std::memory_order_release);
+		return OutVersion;
 	}
 
 	checkf(false, TEXT("Failed to parse release version from command line and ini. Expected in DefaultGame.ini: ProjectVersion=X.Y"));
 	return FExampleVersion(0, 0);
 }
 
+uint64 UExampleAssetManager::GetReleaseVersionKey()
+{
+	using namespace ExampleReleaseVersionContext;
+
+	const uint64 PackedVersion = ResolvedPackedVersion.load(std::memory_order_acquire);
+	return PackedVersion != UnresolvedPackedVersion ? PackedVersion : GetReleaseVersion().GetPackedKey();
+}
+
 bool UExampleAssetManager::DoesVersionRangeInclude(const FExampleVersionRange& VersionRange)
 {
-	// Get target release version
-	const FExampleVersion ReleaseVersion = GetReleaseVersion();
-	// Check if version range includes it
-	return VersionRange.DoesRangeInclude(ReleaseVersion);
+	// Check the range against the target release version, which after the first call is a single atomic load
+	return VersionRange.DoesRangeIncludeKey(GetReleaseVersionKey());
 }
 
-#if WITH_EDITOR
-void UExampleAssetManager::ApplyPrimaryAssetLabels()
+bool UExampleAssetManager::ShouldApplyPrimaryAssetLabelsInParallel()
 {
-	Super::ApplyPrimaryAssetLabels();
+	// Command line takes precedence so both modes can be A/B tested on the same project: -ExampleLabelMode=Parallel|Serial
+	FString CommandLineValue;
+	if (FParse::Value(FCommandLine::Get(), TEXT("ExampleLabelMode="), CommandLineValue))
+	{
+		return CommandLineValue.Equals(TEXT("Parallel"), ESearchCase::IgnoreCase);
+	}
 
-	// Get target release version
-	const FExampleVersion TargetReleaseVersion = GetReleaseVersion();
-	UE_LOG(LogTemp, Log, TEXT("UExampleAssetManager::ApplyPrimaryAssetLabels START - Release version = %s"), *TargetReleaseVersion.ToString());
+	bool bParallel = false;
+	GConfig->GetBool(TEXT("MyGame"), TEXT("bParallelApplyPrimaryAssetLabels"), bParallel, GGameIni);
+	return bParallel;
+}
+
+bool UExampleAssetManager::ShouldReportInclusionFlips()
+{
+	// -ExampleReportInclusionFlips=True|False overrides the config value
+	bool bReportFlips = false;
+	if (!FParse::Bool(FCommandLine::Get(), TEXT("ExampleReportInclusionFlips="), bReportFlips))
+	{
+		GConfig->GetBool(TEXT("MyGame"), TEXT("bReportInclusionFlips"), bReportFlips, GGameIni);
+	}
+	return bReportFlips;
+}
+
+bool UExampleAssetManager::ShouldAssignVersionChunks(int32& OutFirstChunkId)
+{
+	// -ExampleVersionChunks=True|False overrides the config value
+	bool bAssignChunks = false;
+	if (!FParse::Bool(FCommandLine::Get(), TEXT("ExampleVersionChunks="), bAssignChunks))
+	{
+		GConfig->GetBool(TEXT("MyGame"), TEXT("bAssignVersionChunks"), bAssignChunks, GGameIni);
+	}
 
+	// Stay clear of chunk 0, which holds everything that isn't assigned elsewhere
+	OutFirstChunkId = 100;
+	GConfig->GetInt(TEXT("MyGame"), TEXT("FirstVersionChunkId"), OutFirstChunkId, GGameIni);
+	return bAssignChunks;
+}
+
+bool UExampleAssetManager::DoesPrimaryAssetTypeRequireVersionRange(const FPrimaryAssetType& PrimaryAssetType)
+{
+	// Of the registered primary asset types, we don't require the following types to have versioning info.
+	static const TArray<FName> UnversionedPrimaryAssetTypes{"Map", "PrimaryAssetLabel", "GameFeatureData"};
+	return !UnversionedPrimaryAssetTypes.Contains(PrimaryAssetType.GetName());
+}
+
+void UExampleAssetManager::GatherVersionedAssets(TArray<FAssetData>& OutAssets) const
+{
 	// Retrieve list of all primary asset types.
 	TArray<FPrimaryAssetTypeInfo> AssetTypeInfoList;
 	GetPrimaryAssetTypeInfoList(AssetTypeInfoList);
 
-	// Parse them and update their labels depending on whether we want to include it in this build.
 	for (const FPrimaryAssetTypeInfo& AssetTypeInfo : AssetTypeInfoList)
 	{
-		// Gather and iterate all assets
+		// Gather all assets
 		TArray<FAssetData> AllAssetsOfType;
 		GetPrimaryAssetDataList(AssetTypeInfo.PrimaryAssetType, AllAssetsOfType);
 		UE_LOG(LogTemp, Log, TEXT("  Found %d assets of primary asset type '%s'"), AllAssetsOfType.Num(), *AssetTypeInfo.PrimaryAssetType.ToString());
 
-		// Parse all gathered assets of this asset type
+		// Assets of unversioned types keep their cook rule as is
+		if (DoesPrimaryAssetTypeRequireVersionRange(AssetTypeInfo.PrimaryAssetType))
+		{
+			OutAssets.Append(MoveTemp(AllAssetsOfType));
+		}
+	}
+}
+
+void UExampleAssetManager::GatherUnversionedAssetPackages(TArray<FName>& OutPackageNames) const
+{
+	TArray<FPrimaryAssetTypeInfo> AssetTypeInfoList;
+	GetPrimaryAssetTypeInfoList(AssetTypeInfoList);
+
+	for (const FPrimaryAssetTypeInfo& AssetTypeInfo : AssetTypeInfoList)
+	{
+		if (DoesPrimaryAssetTypeRequireVersionRange(AssetTypeInfo.PrimaryAssetType))
+		{
+			continue;
+		}
+
+		TArray<FAssetData> AllAssetsOfType;
+		GetPrimaryAssetDataList(AssetTypeInfo.PrimaryAssetType, AllAssetsOfType);
 		for (const FAssetData& AssetData : AllAssetsOfType)
 		{
-			const FPrimaryAssetId PrimaryAssetId = AssetData.GetPrimaryAssetId();
+			if (GetPrimaryAssetRules(GetPrimaryAssetIdForData(AssetData)).CookRule != EPrimaryAssetCookRule::NeverCook)
+			{
+				OutPackageNames.Add(AssetData.PackageName);
+			}
+		}
+	}
+}
+
+void UExampleAssetManager::EvaluateVersionedAssets(TConstArrayView<FAssetData> Assets, const FExampleVersion& ReleaseVersion, FExampleVersionRangeDecodeCache& DecodeCache,
+	bool bParallel, TArray<FExampleAssetInclusionDecision>& OutDecisions, const FExampleVersionMatrix* PrecomputedMatrix)
+{
+	EXAMPLE_VERSION_GATING_SCOPE(EvaluateVersionedAssets);
+	OutDecisions.Reset();
+	OutDecisions.SetNum(Assets.Num());
+	const int32 MatrixVersionIndex = PrecomputedMatrix ? PrecomputedMatrix->FindVersionIndex(ReleaseVersion) : INDEX_NONE;
+	const EParallelForFlags ParallelForFlags = bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread;
+
+	// Version info lookup:
+	// - UPROPERTY(AssetRegistrySearchable) will have stored the property value as key-value pair, for example AExampleActor
+	// - Alternatively, the GetAssetRegistryTags() override will have stored the key-value pair like in UExampleDataAsset
+	TArray<FName> TagValues;
+	TagValues.SetNum(Assets.Num());
+	ParallelFor(Assets.Num(), [&Assets, &TagValues](int32 Index)
+	{
+		TagValues[Index] = FExampleVersionRangeDecodeCache::GetTagValueName(Assets[Index]);
+	}, ParallelForFlags);
+
+	// Decode the handful of distinct values once, so the parallel pass below only reads the cache and takes no lock.
+	// Assets of the same type tend to be adjacent and share a range, so repeats of the previous value skip the lookup.
+	TArray<int32> EntryIndices;
+	EntryIndices.SetNumUninitialized(Assets.Num());
+	FName PreviousTagValue;
+	int32 PreviousEntryIndex = INDEX_NONE;
+	for (int32 Index = 0; Index < Assets.Num(); ++Index)
+	{
+		if (TagValues[Index].IsNone())
+		{
+			EntryIndices[Index] = INDEX_NONE;
+			continue;
+		}
+		if (PreviousEntryIndex == INDEX_NONE || TagValues[Index] != PreviousTagValue)
+		{
+			PreviousTagValue = TagValues[Index];
+			PreviousEntryIndex = DecodeCache.FindOrDecode(PreviousTagValue);
+		}
+		EntryIndices[Index] = PreviousEntryIndex;
+	}
+
+	// Each index only writes its own decision, so the serial and parallel paths produce identical output
+	const FExampleVersionRangeDecodeCache& ConstDecodeCache = DecodeCache;
+	ParallelFor(Assets.Num(), [&Assets, &ReleaseVersion, &ConstDecodeCache, &EntryIndices, &OutDecisions, PrecomputedMatrix, MatrixVersionIndex](int32 Index)
+	{
+		FExampleAssetInclusionDecision& Decision = OutDecisions[Index];
+		Decision.bHasVersionRange = EntryIndices[Index] != INDEX_NONE;
+		if (!Decision.bHasVersionRange)
+		{
+			return;
+		}
+
+		const FExampleVersionRangeDecodeCache::FEntry& Decoded = ConstDecodeCache.GetEntry(EntryIndices[Index]);
+		Decision.TagValueHash = Decoded.TagValueHash;
+
+		// Reuse the decision of a multi-version evaluation if the asset didn't change since
+		if (MatrixVersionIndex != INDEX_NONE && PrecomputedMatrix->TryGetDecision(Assets[Index].GetPrimaryAssetId(), Decision.TagValueHash,
+			MatrixVersionIndex, Decision.VersionRange, Decision.bShouldInclude))
+		{
+			Decision.Source = EExampleInclusionDecisionSource::VersionMatrix;
+			return;
+		}
+
+		// Decide whether to include asset based on current release version and the asset's version range
+		Decision.VersionRange = Decoded.Range;
+		Decision.bShouldInclude = Decision.VersionRange.DoesRangeInclude(ReleaseVersion);
+	}, ParallelForFlags);
+}
+
+const FExampleVersionIntervalIndex& UExampleAssetManager::GetVersionIntervalIndex(bool bRebuild)
+{
+	if (bVersionIntervalIndexBuilt && !bRebuild)
+	{
+		return VersionIntervalIndex;
+	}
+
+	TArray<FAssetData> VersionedAssets;
+	GatherVersionedAssets(VersionedAssets);
+
+	// Inclusion for the release version itself isn't needed, only the decoded ranges
+	FExampleVersionRangeDecodeCache DecodeCache;
+	TArray<FExampleAssetInclusionDecision> Decisions;
+	EvaluateVersionedAssets(VersionedAssets, GetReleaseVersion(), DecodeCache, true, Decisions);
+
+	TArray<FPrimaryAssetId> AssetIds;
+	TArray<FExampleVersionRange> Ranges;
+	AssetIds.Reserve(VersionedAssets.Num());
+	Ranges.Reserve(VersionedAssets.Num());
+	for (int32 Index = 0; Index < VersionedAssets.Num(); ++Index)
+	{
+		if (Decisions[Index].bHasVersionRange)
+		{
+			AssetIds.Add(VersionedAssets[Index].GetPrimaryAssetId());
+			Ranges.Add(Decisions[Index].VersionRange);
+		}
+	}
 
-			// Of the registered primary asset types, we don't require the following types to have versioning info.
-			static const TArray<FName> UnversionedPrimaryAssetTypes{"Map", "PrimaryAssetLabel", "GameFeatureData"};
-			const bool bRequiresVersionRange = !UnversionedPrimaryAssetTypes.Contains(PrimaryAssetId.PrimaryAssetType);
-			if (!bRequiresVersionRange)
+	VersionIntervalIndex.Build(AssetIds, Ranges);
+	bVersionIntervalIndexBuilt = true;
+	return VersionIntervalIndex;
+}
+
+void UExampleAssetManager::GetAssetsIncludedAtVersion(const FExampleVersion& Version, TArray<FPrimaryAssetId>& OutAssetIds)
+{
+	GetVersionIntervalIndex().GetIncludedAssets(Version, OutAssetIds);
+}
+
+void UExampleAssetManager::GetAssetsChangedBetweenVersions(const FExampleVersion& FromVersion, const FExampleVersion& ToVersion, TArray<FPrimaryAssetId>& OutAddedAssetIds, TArray<FPrimaryAssetId>& OutRemovedAssetIds)
+{
+	GetVersionIntervalIndex().GetChangedAssets(FromVersion, ToVersion, OutAddedAssetIds, OutRemovedAssetIds);
+}
+
+const FExampleInclusionManifest& UExampleAssetManager::GetInclusionManifest()
+{
+	check(IsInGameThread());
+	if (!bInclusionManifestLoaded)
+	{
+		bInclusionManifestLoaded = true;
+		const double StartTime = FPlatformTime::Seconds();
+		if (InclusionManifest.LoadFromFile(FExampleInclusionManifest::GetDefaultFilename()))
+		{
+			UE_LOG(LogTemp, Log, TEXT("Loaded inclusion manifest for %s in %.3f ms: %d plugins, %d shipped assets (%d distinct ranges, %d bytes)"),
+				*InclusionManifest.ReleaseVersion.ToString(), (FPlatformTime::Seconds() - StartTime) * 1000.0, InclusionManifest.Plugins.Num(),
+				InclusionManifest.Assets.Num(), InclusionManifest.Assets.GetNumDistinctRanges(), (int32)InclusionManifest.Assets.GetAllocatedSize());
+		}
+	}
+	return InclusionManifest;
+}
+
+bool UExampleAssetManager::TryGetShippedVersionRange(const FPrimaryAssetId& PrimaryAssetId, FExampleVersionRange& OutRange)
+{
+	return GetInclusionManifest().Assets.TryGetVersionRange(PrimaryAssetId, OutRange);
+}
+
+bool UExampleAssetManager::IsPluginIncludedInBuild(FStringView PluginName)
+{
+	return GetInclusionManifest().IsPluginIncluded(PluginName);
+}
+
+bool UExampleAssetManager::IsShippedAssetIncludedAtVersion(const FPrimaryAssetId& PrimaryAssetId, const FExampleVersion& Version)
+{
+	FExampleVersionRange VersionRange;
+	return TryGetShippedVersionRange(PrimaryAssetId, VersionRange) && VersionRange.DoesRangeInclude(Version);
+}
+
+void UExampleAssetManager::GetPrimaryAssetIdsIncludedAtVersion(const FExampleVersion& Version, TConstArrayView<FPrimaryAssetType> Types, TArray<FPrimaryAssetId>& OutAssetIds)
+{
+	EXAMPLE_VERSION_GATING_SCOPE(GetPrimaryAssetIdsIncludedAtVersion);
+	OutAssetIds.Reset();
+
+	// Cooked registries don't carry VersionRange tags, the manifest has the ranges of everything that shipped
+	const bool bUseManifest = FPlatformProperties::RequiresCookedData();
+	FExampleVersionRangeDecodeCache DecodeCache;
+	TArray<FPrimaryAssetId> TypeAssetIds;
+	for (const FPrimaryAssetType& Type : Types)
+	{
+		TypeAssetIds.Reset();
+		GetPrimaryAssetIdList(Type, TypeAssetIds);
+		if (!DoesPrimaryAssetTypeRequireVersionRange(Type))
+		{
+			OutAssetIds.Append(TypeAssetIds);
+			continue;
+		}
+
+		for (const FPrimaryAssetId& AssetId : TypeAssetIds)
+		{
+			FExampleVersionRange VersionRange;
+			FAssetData AssetData;
+			const bool bHasVersionRange = bUseManifest
+				? TryGetShippedVersionRange(AssetId, VersionRange)
+				: GetPrimaryAssetData(AssetId, AssetData) && DecodeCache.TryGetVersionRange(AssetData, VersionRange);
+			if (bHasVersionRange && VersionRange.DoesRangeInclude(Version))
 			{
-				// Leave their cook rule as is
-				continue;
+				OutAssetIds.Add(AssetId);
 			}
+		}
+	}
+}
 
-			// Version info lookup:
-			// - UPROPERTY(AssetRegistrySearchable) will have stored the property value as key-value pair, for example AExampleActor
-			// - Alternatively, the GetAssetRegistryTags() override will have stored the key-value pair like in UExampleDataAsset
-			FExampleVersionRange AssetVersionRange;
-			if (AssetData.GetTagValue<FExampleVersionRange>(FExampleVersionRange::AssetTagName, AssetVersionRange))
+TSharedPtr<FStreamableHandle> UExampleAssetManager::PreloadVersionedAssets(const FExampleVersion& Version, TConstArrayView<FPrimaryAssetType> Types, const TArray<FName>& Bundles,
+	FStreamableDelegate DelegateToCall, TAsyncLoadPriority Priority, int32 BatchSize)
+{
+	EXAMPLE_VERSION_GATING_SCOPE(PreloadVersionedAssets);
+	BatchSize = FMath::Max(BatchSize, 1);
+
+	TArray<TSharedPtr<FStreamableHandle>> BatchHandles;
+	TArray<FPrimaryAssetId> TypeAssetIds;
+	int32 NumAssets = 0;
+	for (int32 TypeIndex = 0; TypeIndex < Types.Num(); ++TypeIndex)
+	{
+		GetPrimaryAssetIdsIncludedAtVersion(Version, MakeArrayView(&Types[TypeIndex], 1), TypeAssetIds);
+		NumAssets += TypeAssetIds.Num();
+		for (int32 BatchStart = 0; BatchStart < TypeAssetIds.Num(); BatchStart += BatchSize)
+		{
+			const TArray<FPrimaryAssetId> BatchAssetIds(TypeAssetIds.GetData() + BatchStart, FMath::Min(BatchSize, TypeAssetIds.Num() - BatchStart));
+			// Returns nullptr for batches that are loaded already
+			if (TSharedPtr<FStreamableHandle> BatchHandle = LoadPrimaryAssets(BatchAssetIds, Bundles, FStreamableDelegate(), Priority - TypeIndex))
 			{
-				// Decide whether to include asset based on current release version and the asset's version range
-				const bool bShouldIncludeAsset = AssetVersionRange.DoesRangeInclude(TargetReleaseVersion);
+				BatchHandles.Add(BatchHandle);
+			}
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Preloading %d assets of %d primary asset types included at %s in %d batches"), NumAssets, Types.Num(), *Version.ToString(), BatchHandles.Num());
+	TSharedPtr<FStreamableHandle> CombinedHandle = BatchHandles.Num() > 0
+		? GetStreamableManager().CreateCombinedHandle(BatchHandles, FString::Printf(TEXT("PreloadVersionedAssets(%s)"), *Version.ToString()))
+		: nullptr;
+	if (!CombinedHandle.IsValid())
+	{
+		DelegateToCall.ExecuteIfBound();
+		return nullptr;
+	}
+
+	CombinedHandle->BindCompleteDelegate(MoveTemp(DelegateToCall));
+	return CombinedHandle;
+}
+
+#if WITH_EDITOR
+void UExampleAssetManager::ApplyPrimaryAssetLabels()
+{
+	EXAMPLE_VERSION_GATING_SCOPE(ApplyPrimaryAssetLabels);
+	Super::ApplyPrimaryAssetLabels();
+
+	// Workers of a multiprocess cook only replay what the director decided
+	if (FExampleCookDecisionTable::IsCookWorker())
+	{
+		ApplyCookDirectorDecisions();
+		return;
+	}
+
+	// Get target release version
+	const FExampleVersion TargetReleaseVersion = GetReleaseVersion();
+	const bool bParallel = ShouldApplyPrimaryAssetLabelsInParallel();
+	UE_LOG(LogTemp, Log, TEXT("UExampleAssetManager::ApplyPrimaryAssetLabels START - Release version = %s, %s evaluation"),
+		*TargetReleaseVersion.ToString(), bParallel ? TEXT("parallel") : TEXT("serial"));
+
+	// Take a flat snapshot of all assets that require versioning info, so they can be evaluated in one go.
+	TArray<FAssetData> VersionedAssets;
+	GatherVersionedAssets(VersionedAssets);
+
+	// Optionally reuse decisions of a single multi-version scan by UExampleVersionMatrixCommandlet
+	FExampleVersionMatrix VersionMatrix;
+	FString VersionMatrixFilename;
+	const bool bUseVersionMatrix = FParse::Value(FCommandLine::Get(), TEXT("ExampleVersionMatrix="), VersionMatrixFilename) && VersionMatrix.LoadFromFile(VersionMatrixFilename);
+	if (bUseVersionMatrix && VersionMatrix.FindVersionIndex(TargetReleaseVersion) == INDEX_NONE)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Version matrix '%s' wasn't evaluated for %s, evaluating all assets."), *VersionMatrixFilename, *TargetReleaseVersion.ToString());
+	}
+
+	// Decide for all of them whether we want to include it in this build. Most assets share a handful of distinct ranges,
+	// so decode each distinct tag value only once.
+	FExampleVersionRangeDecodeCache DecodeCache;
+	TArray<FExampleAssetInclusionDecision> Decisions;
+	EvaluateVersionedAssets(VersionedAssets, TargetReleaseVersion, DecodeCache, bParallel, Decisions, bUseVersionMatrix ? &VersionMatrix : nullptr);
+
+	// Commit all decisions in snapshot order. Individual decisions go to the journal instead of the cook log,
+	// run with -ExampleInclusionJournal=Decisions to see them.
+	FExampleInclusionJournal Journal(FExampleInclusionJournal::GetConfiguredVerbosity(), TargetReleaseVersion);
+
+	// Optionally give each version interval its own chunk, so included content is split into version-scoped containers
+	int32 FirstVersionChunkId = 0;
+	const bool bAssignVersionChunks = ShouldAssignVersionChunks(FirstVersionChunkId);
+	FExampleVersionChunks VersionChunks;
+	if (bAssignVersionChunks)
+	{
+		VersionChunks.Load(FExampleVersionChunks::GetInputFilename(), FirstVersionChunkId);
+	}
+	// Decisions to replicate to cook workers, if there will be any
+	const bool bWriteCookDecisionTable = FExampleCookDecisionTable::IsMultiprocessCookDirector();
+	FExampleCookDecisionTable CookDecisionTable;
+	CookDecisionTable.ReleaseVersion = TargetReleaseVersion;
+	if (bWriteCookDecisionTable)
+	{
+		CookDecisionTable.SessionId = FExampleCookDecisionTable::BeginDirectorSession();
+	}
 
-				// Warning log level is just to highlight these messages for the tutorial when executing from shell. In production you wouldn't do this.
-				UE_LOG(LogTemp, Warning, TEXT("  Asset '%s' has release versioning info: %s"), *AssetData.GetObjectPathString(), *AssetVersionRange.ToString());
-				UE_LOG(LogTemp, Warning, TEXT("  --> %s asset '%s'"), bShouldIncludeAsset ? TEXT("Including") : TEXT("Excluding"), *AssetData.GetObjectPathString());
+	int32 NumIncluded = 0, NumExcluded = 0;
+	for (int32 TypeStart = 0; TypeStart < VersionedAssets.Num();)
+	{
+		// Assets are gathered in primary asset type order, commit one type at a time so each gets its own trace scope
+		const FPrimaryAssetType PrimaryAssetType = VersionedAssets[TypeStart].GetPrimaryAssetId().PrimaryAssetType;
+		int32 TypeEnd = TypeStart + 1;
+		while (TypeEnd < VersionedAssets.Num() && VersionedAssets[TypeEnd].GetPrimaryAssetId().PrimaryAssetType == PrimaryAssetType)
+		{
+			++TypeEnd;
+		}
 
+		EXAMPLE_VERSION_GATING_SCOPE_TEXT(*FString::Printf(TEXT("ApplyPrimaryAssetLabels/%s"), *PrimaryAssetType.ToString()));
+		for (int32 Index = TypeStart; Index < TypeEnd; ++Index)
+		{
+			const FAssetData& AssetData = VersionedAssets[Index];
+			const FExampleAssetInclusionDecision& Decision = Decisions[Index];
+			const FPrimaryAssetId PrimaryAssetId = AssetData.GetPrimaryAssetId();
+			Journal.Record(PrimaryAssetId, Decision);
+			if (Decision.bHasVersionRange)
+			{
 				// Override the cook rule based on that decision
 				FPrimaryAssetRules Rules = GetPrimaryAssetRules(PrimaryAssetId);
-				Rules.CookRule = bShouldIncludeAsset ? EPrimaryAssetCookRule::AlwaysCook : EPrimaryAssetCookRule::NeverCook;
+				Rules.CookRule = Decision.bShouldInclude ? EPrimaryAssetCookRule::AlwaysCook : EPrimaryAssetCookRule::NeverCook;
+				// Chunks set by primary asset rules or labels win. A version chunk from an earlier pass is reassigned.
+				const bool bAssignVersionChunk = bAssignVersionChunks && Decision.bShouldInclude
+					&& (Rules.ChunkId == INDEX_NONE || VersionChunks.IsVersionChunk(Rules.ChunkId));
+				if (bAssignVersionChunk)
+				{
+					Rules.ChunkId = VersionChunks.AssignChunk(Decision.VersionRange);
+				}
 				SetPrimaryAssetRules(PrimaryAssetId, Rules);
+				if (bWriteCookDecisionTable)
+				{
+					CookDecisionTable.Add(PrimaryAssetId, Decision.VersionRange, Decision.bShouldInclude, bAssignVersionChunk ? Rules.ChunkId : INDEX_NONE);
+				}
+				NumIncluded += Decision.bShouldInclude ? 1 : 0;
+				NumExcluded += Decision.bShouldInclude ? 0 : 1;
 			}
 			else
 			{
@@ -188,8 +621,149 @@ void UExampleAssetManager::ApplyPrimaryAssetLabels()
 				UE_LOG(LogTemp, Error, TEXT("  Asset '%s' did NOT have a release version as asset tag!"), *AssetData.GetObjectPathString());
 			}
 		}
+		TypeStart = TypeEnd;
+	}
+	Journal.Finish();
+	EXAMPLE_VERSION_GATING_COUNTER_ADD(AssetsEvaluated, Decisions.Num());
+	EXAMPLE_VERSION_GATING_COUNTER_ADD(AssetsIncluded, NumIncluded);
+	EXAMPLE_VERSION_GATING_COUNTER_ADD(AssetsExcluded, NumExcluded);
+
+	// Workers are launched after the director finished initializing, so the table is in place before any of them reads it
+	if (bWriteCookDecisionTable && CookDecisionTable.SaveToFile(FExampleCookDecisionTable::GetDefaultFilename()))
+	{
+		UE_LOG(LogTemp, Log, TEXT("  Wrote cook decision table '%s' with %d decisions for cook workers of session %s"),
+			*FExampleCookDecisionTable::GetDefaultFilename(), CookDecisionTable.Num(), *CookDecisionTable.SessionId.ToString());
+	}
+
+	// Record the asset decisions in the inclusion manifest that ships with the build, the cooked asset registry doesn't keep the tags
+	if (IsRunningCookCommandlet())
+	{
+		WriteInclusionManifest(TargetReleaseVersion, VersionedAssets, Decisions);
+	}
+
+	// Only the director or a single process cook gets here, cook workers replayed its decisions and returned above
+	if (bAssignVersionChunks && VersionChunks.Save(FExampleVersionChunks::GetOutputFilename(), TargetReleaseVersion))
+	{
+		UE_LOG(LogTemp, Log, TEXT("  Wrote version chunk manifest '%s'"), *FExampleVersionChunks::GetOutputFilename());
+		if (VersionChunks.GetNumNewChunks() > 0)
+		{
+			UE_LOG(LogTemp, Display, TEXT("  %d new version chunks were assigned. Copy '%s' over '%s' to keep their ids stable in later releases."),
+				VersionChunks.GetNumNewChunks(), *FExampleVersionChunks::GetOutputFilename(), *FExampleVersionChunks::GetInputFilename());
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("  Decoded %d distinct version range tag values (%d cache hits, %d legacy values parsed with ImportText)"),
+		DecodeCache.GetNumDistinctValues(), DecodeCache.GetNumHits(), DecodeCache.GetNumLegacyMisses());
+	if (bUseVersionMatrix)
+	{
+		const int32 NumFromMatrix = Algo::CountIf(Decisions, [](const FExampleAssetInclusionDecision& Decision) { return Decision.Source == EExampleInclusionDecisionSource::VersionMatrix; });
+		UE_LOG(LogTemp, Log, TEXT("  Reused %d of %d decisions from version matrix '%s'"), NumFromMatrix, Decisions.Num(), *VersionMatrixFilename);
+	}
+	if (ShouldReportInclusionFlips())
+	{
+		RecordInclusionFlips(TargetReleaseVersion, VersionedAssets, Decisions);
 	}
 
+	// Fail before any package is saved if included content references excluded content
+	if (FExampleInclusionValidator::IsEnabledForCook())
+	{
+		TArray<FExampleInclusionViolation> Violations;
+		TArray<FName> UnversionedPackages;
+		GatherUnversionedAssetPackages(UnversionedPackages);
+		FExampleInclusionValidator::FindViolations(VersionedAssets, Decisions, UnversionedPackages, Violations);
+		for (const FExampleInclusionViolation& Violation : Violations)
+		{
+			// This error message will fail the cook
+			UE_LOG(LogTemp, Error, TEXT("  Included package '%s' references version excluded package '%s': %s"),
+				*Violation.GetReferencer().ToString(), *Violation.GetExcludedPackage().ToString(), *Violation.ToString());
+		}
+		UE_LOG(LogTemp, Log, TEXT("  Validated inclusion closure, %d references to excluded content"), Violations.Num());
+	}
 	UE_LOG(LogTemp, Log, TEXT("UExampleAssetManager::ApplyPrimaryAssetLabels END"));
 }
+
+void UExampleAssetManager::ApplyCookDirectorDecisions()
+{
+	FExampleCookDecisionTable CookDecisionTable;
+	if (!CookDecisionTable.LoadFromFile(FExampleCookDecisionTable::GetDefaultFilename()))
+	{
+		// This error message will fail the cook
+		UE_LOG(LogTemp, Error, TEXT("UExampleAssetManager::ApplyPrimaryAssetLabels - Cook worker has no decisions from its cook director"));
+		return;
+	}
+	if (!CookDecisionTable.SessionId.IsValid() || CookDecisionTable.SessionId != FExampleCookDecisionTable::GetDirectorSessionId())
+	{
+		// This error message will fail the cook. Replaying a stale table would cook another session's decisions.
+		UE_LOG(LogTemp, Error, TEXT("UExampleAssetManager::ApplyPrimaryAssetLabels - Cook decision table is from cook session %s, this worker's director is session %s"),
+			*CookDecisionTable.SessionId.ToString(), *FExampleCookDecisionTable::GetDirectorSessionId().ToString());
+		return;
+	}
+
+	for (int32 Index = 0; Index < CookDecisionTable.Num(); ++Index)
+	{
+		FPrimaryAssetRules Rules = GetPrimaryAssetRules(CookDecisionTable.AssetIds[Index]);
+		Rules.CookRule = CookDecisionTable.Included[Index] ? EPrimaryAssetCookRule::AlwaysCook : EPrimaryAssetCookRule::NeverCook;
+		if (CookDecisionTable.ChunkIds[Index] != INDEX_NONE)
+		{
+			Rules.ChunkId = CookDecisionTable.ChunkIds[Index];
+		}
+		SetPrimaryAssetRules(CookDecisionTable.AssetIds[Index], Rules);
+	}
+	UE_LOG(LogTemp, Log, TEXT("UExampleAssetManager::ApplyPrimaryAssetLabels - Cook worker applied %d decisions from its cook director for %s"),
+		CookDecisionTable.Num(), *CookDecisionTable.ReleaseVersion.ToString());
+}
+
+void UExampleAssetManager::WriteInclusionManifest(const FExampleVersion& ReleaseVersion, TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions)
+{
+	// Keep the plugin decisions UBT recorded for the same release version
+	const FString ManifestFilename = FExampleInclusionManifest::GetDefaultFilename();
+	FExampleInclusionManifest Manifest;
+	if (!Manifest.LoadFromFile(ManifestFilename) || Manifest.ReleaseVersion != ReleaseVersion)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("  Inclusion manifest '%s' has no plugin decisions for %s, build the game target for this release version before cooking."),
+			*ManifestFilename, *ReleaseVersion.ToString());
+		Manifest = FExampleInclusionManifest();
+		Manifest.ReleaseVersion = ReleaseVersion;
+	}
+
+	TArray<FPrimaryAssetId> ShippedAssetIds;
+	TArray<FExampleVersionRange> ShippedRanges;
+	for (int32 Index = 0; Index < Assets.Num(); ++Index)
+	{
+		if (Decisions[Index].bHasVersionRange && Decisions[Index].bShouldInclude)
+		{
+			ShippedAssetIds.Add(Assets[Index].GetPrimaryAssetId());
+			ShippedRanges.Add(Decisions[Index].VersionRange);
+		}
+	}
+
+	if (Manifest.Assets.Build(ShippedAssetIds, ShippedRanges) && Manifest.SaveToFile(ManifestFilename))
+	{
+		UE_LOG(LogTemp, Log, TEXT("  Wrote inclusion manifest '%s': %d plugins, %d assets in %d bytes"),
+			*ManifestFilename, Manifest.Plugins.Num(), Manifest.Assets.Num(), (int32)Manifest.Assets.GetAllocatedSize());
+	}
+}
+
+void UExampleAssetManager::RecordInclusionFlips(const FExampleVersion& ReleaseVersion, TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions)
+{
+	FExampleInclusionDecisionCache DecisionCache;
+	DecisionCache.LoadFromFile(FExampleInclusionDecisionCache::GetDefaultFilename());
+	TArray<FName> IncludedPackages, ExcludedPackages;
+	DecisionCache.RecordDecisions(ReleaseVersion, Assets, Decisions, IncludedPackages, ExcludedPackages);
+	DecisionCache.SaveToFile(FExampleInclusionDecisionCache::GetDefaultFilename());
+
+	// Only these packages need their cooked output redone because of versioning. Written to a file for build scripts,
+	// this cook itself still evaluated every asset.
+	UE_LOG(LogTemp, Log, TEXT("  %d packages flipped to included, %d packages flipped to excluded since the previous cook"), IncludedPackages.Num(), ExcludedPackages.Num());
+	TArray<FString> FlippedLines;
+	for (const FName& PackageName : IncludedPackages)
+	{
+		FlippedLines.Add(TEXT("+") + PackageName.ToString());
+	}
+	for (const FName& PackageName : ExcludedPackages)
+	{
+		FlippedLines.Add(TEXT("-") + PackageName.ToString());
+	}
+	FFileHelper::SaveStringArrayToFile(FlippedLines, *(FPaths::GetPath(FExampleInclusionDecisionCache::GetDefaultFilename()) / TEXT("FlippedPackages.txt")));
+}
 #endif
@@ -5,8 +5,36 @@
 #include "CoreMinimal.h"
 #include "Engine/AssetManager.h"
 #include "ExampleVersionRange.h"
+#include "ExampleVersionIntervalIndex.h"
+#include "ExampleInclusionManifest.h"
 #include "ExampleAssetManager.generated.h"
 
+class FExampleVersionRangeDecodeCache;
+struct FExampleVersionMatrix;
+
+// Where an inclusion decision came from
+enum class EExampleInclusionDecisionSource : uint8
+{
+	// Version range was decoded and evaluated
+	Evaluated,
+	// Taken from a precomputed FExampleVersionMatrix
+	VersionMatrix,
+};
+
+// Outcome of evaluating a single versioned primary asset against a release version
+struct FExampleAssetInclusionDecision
+{
+	// Whether the asset had a VersionRange tag at all. Assets without one are an error and are left untouched.
+	bool bHasVersionRange = false;
+	// Whether the release version falls inside VersionRange
+	bool bShouldInclude = false;
+	EExampleInclusionDecisionSource Source = EExampleInclusionDecisionSource::Evaluated;
+	// FExampleVersionRange::HashAssetTagValue of the tag value
+	uint32 TagValueHash = 0;
+	// Decoded version range, only valid if bHasVersionRange
+	FExampleVersionRange VersionRange;
+};
+
 /**
  * Example implementation of a custom asset manager, which is consulted at cook-time to help decide which 
  * assets to include in the build. The project's asset manager should be set to this class either via
@@ -18,17 +46,91 @@ class BUILDTIMEINCLUDE_API UExampleAssetManager : public UAssetManager
 	GENERATED_BODY()
 
 private:
-	static bool TryParseReleaseVersion(const FString& StringValue, FExampleVersion& OutReleaseVersion);
 	static bool TryGetReleaseVersionFromEnvVar(FExampleVersion& OutReleaseVersion);
 	static bool TryGetReleaseVersionFromCommandLine(FExampleVersion& OutReleaseVersion);
 	static bool TryGetReleaseVersionFromConfig(FExampleVersion& OutReleaseVersion);
+	static bool TryGetReleaseVersionFromManifest(FExampleVersion& OutReleaseVersion);
+	static bool TryGetReleaseVersionFromCookDirector(FExampleVersion& OutReleaseVersion);
+	static bool ShouldApplyPrimaryAssetLabelsInParallel();
+	static bool ShouldReportInclusionFlips();
+	static bool ShouldAssignVersionChunks(int32& OutFirstChunkId);
 
 public:
+	// Parse a string like X.Y into Major and Minor components
+	static bool TryParseReleaseVersion(const FString& StringValue, FExampleVersion& OutReleaseVersion);
+
+	// Resolved once on first use, thread-safe
 	static FExampleVersion GetReleaseVersion();
+	// FExampleVersion::GetPackedKey of GetReleaseVersion(), without unpacking it again
+	static uint64 GetReleaseVersionKey();
+	// Two packed key compares against the release version. Thread-safe, cheap enough for every actor instance in PostLoad.
 	static bool DoesVersionRangeInclude(const FExampleVersionRange& VersionRange);
 
+	// Whether assets of this primary asset type are expected to carry a VersionRange tag
+	static bool DoesPrimaryAssetTypeRequireVersionRange(const FPrimaryAssetType& PrimaryAssetType);
+
+	// Gather the asset data of all primary assets whose type requires a VersionRange, in primary asset type order
+	void GatherVersionedAssets(TArray<FAssetData>& OutAssets) const;
+
+	// Gather the package names of all primary assets of unversioned types, such as GameFeatureData and PrimaryAssetLabel,
+	// that aren't marked NeverCook. They get cooked regardless of version, so their references have to be validated too.
+	void GatherUnversionedAssetPackages(TArray<FName>& OutPackageNames) const;
+
+	// Decode the version range of every asset and decide its inclusion for ReleaseVersion. Touches no asset manager
+	// state, so with bParallel the assets are spread across all worker threads. OutDecisions matches Assets by index
+	// and is identical regardless of bParallel. Decisions found in PrecomputedMatrix are reused instead of evaluated.
+	static void EvaluateVersionedAssets(TConstArrayView<FAssetData> Assets, const FExampleVersion& ReleaseVersion, FExampleVersionRangeDecodeCache& DecodeCache,
+		bool bParallel, TArray<FExampleAssetInclusionDecision>& OutDecisions, const FExampleVersionMatrix* PrecomputedMatrix = nullptr);
+
+	// Index over the version ranges of all versioned primary assets, built on first use. Pass bRebuild to pick up
+	// asset changes made since. See UExampleVersionQueryCommandlet for command line access.
+	const FExampleVersionIntervalIndex& GetVersionIntervalIndex(bool bRebuild = false);
+
+	// Which primary assets are included at Version
+	void GetAssetsIncludedAtVersion(const FExampleVersion& Version, TArray<FPrimaryAssetId>& OutAssetIds);
+
+	// Which primary assets change inclusion between two versions, for example to size a patch
+	void GetAssetsChangedBetweenVersions(const FExampleVersion& FromVersion, const FExampleVersion& ToVersion, TArray<FPrimaryAssetId>& OutAddedAssetIds, TArray<FPrimaryAssetId>& OutRemovedAssetIds);
+
+	// Inclusion decisions this build was made with: plugins decided by UBT, primary assets decided by the cook. The cooked
+	// asset registry doesn't carry VersionRange tags, use this at runtime. Loaded on first use, game thread only.
+	const FExampleInclusionManifest& GetInclusionManifest();
+	bool TryGetShippedVersionRange(const FPrimaryAssetId& PrimaryAssetId, FExampleVersionRange& OutRange);
+	bool IsPluginIncludedInBuild(FStringView PluginName);
+	// False for assets without a shipped version range
+	bool IsShippedAssetIncludedAtVersion(const FPrimaryAssetId& PrimaryAssetId, const FExampleVersion& Version);
+
+	// Primary assets of Types whose version range includes Version, in Types order. Uses the inclusion manifest in cooked
+	// builds and asset registry tags otherwise. Types that don't require a version range contribute all of their assets.
+	void GetPrimaryAssetIdsIncludedAtVersion(const FExampleVersion& Version, TConstArrayView<FPrimaryAssetType> Types, TArray<FPrimaryAssetId>& OutAssetIds);
+
+	// Asynchronously load the primary assets of Types included at Version, for example to warm up a release's content
+	// before its actors spawn or its GameFeature components get applied. Assets are requested through LoadPrimaryAssets
+	// in batches of BatchSize, with Bundles, so each streaming request stays small. Types earlier in the list get a
+	// higher priority, starting at Priority. The returned combined handle reports progress through GetProgress() and
+	// BindUpdateDelegate(), and CancelHandle() cancels every batch. Returns nullptr and calls DelegateToCall right away
+	// if there's nothing left to load.
+	TSharedPtr<FStreamableHandle> PreloadVersionedAssets(const FExampleVersion& Version, TConstArrayView<FPrimaryAssetType> Types, const TArray<FName>& Bundles = TArray<FName>(),
+		FStreamableDelegate DelegateToCall = FStreamableDelegate(), TAsyncLoadPriority Priority = FStreamableManager::AsyncLoadHighPriority, int32 BatchSize = 64);
+
 #if WITH_EDITOR
 	virtual void ApplyPrimaryAssetLabels() override;
 #endif
+
+private:
+#if WITH_EDITOR
+	// Set the cook rules the cook director decided, on a cook worker
+	void ApplyCookDirectorDecisions();
+	// Record the shipped assets' ranges in the inclusion manifest, next to the plugin decisions UBT wrote
+	void WriteInclusionManifest(const FExampleVersion& ReleaseVersion, TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions);
+	// Store this cook's decisions for the next one and report which packages flipped inclusion since the previous one
+	void RecordInclusionFlips(const FExampleVersion& ReleaseVersion, TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions);
+#endif
+
+	FExampleVersionIntervalIndex VersionIntervalIndex;
+	bool bVersionIntervalIndexBuilt = false;
+
+	FExampleInclusionManifest InclusionManifest;
+	bool bInclusionManifestLoaded = false;
 	
 };
@@ -0,0 +1,46 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExampleVersion.h"
+
+// Generated per target by BuildTimeInclude.Target.cs, see BuildTimeIncludeTarget.WriteReleaseVersionHeader
+#include "ExampleReleaseVersionGenerated.h"
+
+/**
+ * The release version the binary was compiled for, so code can be gated the same way content is. Code for features
+ * outside the release is compiled out instead of shipping and checking UExampleAssetManager::GetReleaseVersion() at runtime:
+ *
+ *   if constexpr (ExampleCompiledVersion::IsVersionIncluded<FExampleVersion(5, 0).GetPackedKey()>())
+ *   {
+ *       // Only compiled into builds for release 5.0 and later
+ *   }
+ *
+ * Same semantics as FExampleVersionRange: intro version inclusive, sunset version exclusive. Editor targets compile
+ * with EXAMPLE_COMPILED_VERSION_GATING 0, where everything is included so content for any release can be authored and cooked.
+ */
+namespace ExampleCompiledVersion
+{
+	inline constexpr FExampleVersion ReleaseVersion(EXAMPLE_COMPILED_RELEASE_VERSION_MAJOR, EXAMPLE_COMPILED_RELEASE_VERSION_MINOR);
+	inline constexpr bool bVersionGating = EXAMPLE_COMPILED_VERSION_GATING != 0;
+
+	// Keys are FExampleVersion::GetPackedKey() values. The default sunset key means no sunset version.
+	template <uint64 IntroKey, uint64 SunsetKey = MAX_uint64>
+	constexpr bool IsVersionIncluded()
+	{
+		static_assert(IntroKey <= SunsetKey, "Sunset version must not be before the intro version");
+		return !bVersionGating || (ReleaseVersion.GetPackedKey() >= IntroKey && (SunsetKey == MAX_uint64 || ReleaseVersion.GetPackedKey() < SunsetKey));
+	}
+
+	// Same as the template, for use in constant expressions that already hold FExampleVersion values
+	constexpr bool IsVersionIncluded(const FExampleVersion IntroVersion)
+	{
+		return !bVersionGating || ReleaseVersion.GetPackedKey() >= IntroVersion.GetPackedKey();
+	}
+
+	constexpr bool IsVersionIncluded(const FExampleVersion IntroVersion, const FExampleVersion SunsetVersion)
+	{
+		return !bVersionGating || (ReleaseVersion.GetPackedKey() >= IntroVersion.GetPackedKey() && ReleaseVersion.GetPackedKey() < SunsetVersion.GetPackedKey());
+	}
+}
@@ -0,0 +1,171 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleCookDecisionTable.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace ExampleCookDecisionTable
+{
+	static constexpr uint32 FileMagic = 0x54435845; // 'EXCT'
+	static constexpr uint32 FileVersion = 2;
+	static const TCHAR* SessionEnvironmentVariable = TEXT("EXAMPLE_COOK_SESSION");
+
+	static bool SerializeHeader(FArchive& Ar, FExampleVersion& ReleaseVersion, FGuid& SessionId)
+	{
+		uint32 Magic = FileMagic;
+		uint32 Version = FileVersion;
+		Ar << Magic << Version;
+		if (Magic != FileMagic || Version != FileVersion)
+		{
+			Ar.SetError();
+			return false;
+		}
+		Ar << ReleaseVersion << SessionId;
+		return !Ar.IsError();
+	}
+}
+
+bool FExampleCookDecisionTable::Add(const FPrimaryAssetId& AssetId, const FExampleVersionRange& Range, bool bInclude, int32 ChunkId)
+{
+	const uint16* RangeIndex = RangeToIndex.Find(Range);
+	if (!RangeIndex)
+	{
+		if (Ranges.Num() > MAX_uint16)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Cook decision table supports at most %d distinct version ranges."), MAX_uint16 + 1);
+			return false;
+		}
+		RangeIndex = &RangeToIndex.Add(Range, (uint16)Ranges.Add(Range));
+	}
+
+	AssetIds.Add(AssetId);
+	RangeIndices.Add(*RangeIndex);
+	Included.Add(bInclude);
+	ChunkIds.Add(ChunkId);
+	return true;
+}
+
+bool FExampleCookDecisionTable::SaveToFile(const FString& Filename) const
+{
+	const FString TempFilename = Filename + TEXT(".tmp");
+	{
+		TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempFilename));
+		if (!Writer)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to open cook decision table '%s' for writing."), *TempFilename);
+			return false;
+		}
+
+		const_cast<FExampleCookDecisionTable*>(this)->Serialize(*Writer);
+		if (!Writer->Close())
+		{
+			return false;
+		}
+	}
+	return IFileManager::Get().Move(*Filename, *TempFilename, true, true);
+}
+
+bool FExampleCookDecisionTable::LoadFromFile(const FString& Filename)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Reader)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to open cook decision table '%s' for reading."), *Filename);
+		return false;
+	}
+
+	Serialize(*Reader);
+	if (Reader->IsError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Cook decision table '%s' is corrupt or was written by an incompatible version."), *Filename);
+		*this = FExampleCookDecisionTable();
+		return false;
+	}
+	return true;
+}
+
+void FExampleCookDecisionTable::Serialize(FArchive& Ar)
+{
+	if (!ExampleCookDecisionTable::SerializeHeader(Ar, ReleaseVersion, SessionId))
+	{
+		return;
+	}
+
+	// Primary asset ids are written as strings, FName serialization isn't portable for plain file archives
+	int32 NumAssets = AssetIds.Num();
+	Ar << NumAssets;
+	if (Ar.IsLoading())
+	{
+		if (NumAssets < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		AssetIds.SetNum(NumAssets);
+	}
+	for (FPrimaryAssetId& AssetId : AssetIds)
+	{
+		FString Type = AssetId.PrimaryAssetType.ToString();
+		FString Name = AssetId.PrimaryAssetName.ToString();
+		Ar << Type << Name;
+		if (Ar.IsLoading())
+		{
+			AssetId = FPrimaryAssetId(FPrimaryAssetType(*Type), FName(*Name));
+		}
+	}
+
+	Ar << RangeIndices << Included << ChunkIds << Ranges;
+
+	// Reject files whose per-asset arrays don't line up
+	if (Ar.IsLoading() && (RangeIndices.Num() != NumAssets || Included.Num() != NumAssets || ChunkIds.Num() != NumAssets
+		|| RangeIndices.ContainsByPredicate([this](uint16 RangeIndex) { return !Ranges.IsValidIndex(RangeIndex); })))
+	{
+		Ar.SetError();
+	}
+}
+
+bool FExampleCookDecisionTable::TryReadReleaseVersion(const FString& Filename, FExampleVersion& OutReleaseVersion, FGuid& OutSessionId)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent));
+	FExampleVersion ReleaseVersion;
+	FGuid SessionId;
+	if (!Reader || !ExampleCookDecisionTable::SerializeHeader(*Reader, ReleaseVersion, SessionId))
+	{
+		return false;
+	}
+	OutReleaseVersion = ReleaseVersion;
+	OutSessionId = SessionId;
+	return true;
+}
+
+FString FExampleCookDecisionTable::GetDefaultFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ExampleInclusion") / TEXT("CookDecisionTable.bin");
+}
+
+bool FExampleCookDecisionTable::IsMultiprocessCookDirector()
+{
+	int32 CookProcessCount = 1;
+	return IsRunningCookCommandlet() && !IsCookWorker() && FParse::Value(FCommandLine::Get(), TEXT("-CookProcessCount="), CookProcessCount) && CookProcessCount > 1;
+}
+
+bool FExampleCookDecisionTable::IsCookWorker()
+{
+	// Workers are launched with the address of their director
+	FString DirectorHost;
+	return IsRunningCookCommandlet() && (FParse::Param(FCommandLine::Get(), TEXT("CookWorker")) || FParse::Value(FCommandLine::Get(), TEXT("-CookDirectorHost="), DirectorHost));
+}
+
+FGuid FExampleCookDecisionTable::BeginDirectorSession()
+{
+	const FGuid SessionId = FGuid::NewGuid();
+	FPlatformMisc::SetEnvironmentVar(ExampleCookDecisionTable::SessionEnvironmentVariable, *SessionId.ToString());
+	return SessionId;
+}
+
+FGuid FExampleCookDecisionTable::GetDirectorSessionId()
+{
+	FGuid SessionId;
+	FGuid::Parse(FPlatformMisc::GetEnvironmentVariable(ExampleCookDecisionTable::SessionEnvironmentVariable), SessionId);
+	return SessionId;
+}
@@ -0,0 +1,59 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExampleVersionRange.h"
+
+/**
+ * Inclusion decisions of a multiprocess cook, computed once by the cook director and replicated to its cook workers.
+ * The director writes it at the end of ApplyPrimaryAssetLabels, before it launches any workers. Workers take both the
+ * release version and every cook rule from it instead of resolving the version and scanning the registry themselves,
+ * so all processes of one cook agree by construction.
+ *
+ * The file outlives the cook, so it carries the id of the director session that wrote it. The director also puts that
+ * id in the EXAMPLE_COOK_SESSION environment variable, which the worker processes it launches inherit. A worker
+ * rejects a table from any other session, for example one left behind by an earlier cook whose director failed before
+ * writing a new one.
+ *
+ * Compact layout: distinct ranges are stored once and referenced by 16-bit index, inclusion is a bit per asset.
+ */
+class BUILDTIMEINCLUDE_API FExampleCookDecisionTable
+{
+public:
+	FExampleVersion ReleaseVersion;
+	FGuid SessionId;
+	TArray<FPrimaryAssetId> AssetIds;
+	TArray<uint16> RangeIndices;
+	TBitArray<> Included;
+	// Chunk the director assigned, INDEX_NONE if it left the asset's chunk alone
+	TArray<int32> ChunkIds;
+	TArray<FExampleVersionRange> Ranges;
+
+	// Fails on more than 65536 distinct ranges
+	bool Add(const FPrimaryAssetId& AssetId, const FExampleVersionRange& Range, bool bInclude, int32 ChunkId);
+	int32 Num() const { return AssetIds.Num(); }
+
+	// Written to a temporary file first and moved into place, so a worker never reads a partial table
+	bool SaveToFile(const FString& Filename) const;
+	bool LoadFromFile(const FString& Filename);
+	void Serialize(FArchive& Ar);
+
+	// Only reads the header
+	static bool TryReadReleaseVersion(const FString& Filename, FExampleVersion& OutReleaseVersion, FGuid& OutSessionId);
+
+	static FString GetDefaultFilename();
+
+	// Whether this process is the director of a cook that launches worker processes (-CookProcessCount=N with N > 1)
+	static bool IsMultiprocessCookDirector();
+	// Whether this process is a worker launched by a cook director
+	static bool IsCookWorker();
+
+	// Director: create a new session id and export it to the environment of the workers launched from now on
+	static FGuid BeginDirectorSession();
+	// Worker: the session id inherited from the director, invalid if there is none
+	static FGuid GetDirectorSessionId();
+
+private:
+	TMap<FExampleVersionRange, uint16> RangeToIndex;
+};
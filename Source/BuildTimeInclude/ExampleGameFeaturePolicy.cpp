@@ -0,0 +1,29 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleGameFeaturePolicy.h"
+#include "ExampleAssetManager.h"
+#include "GameFeaturesSubsystem.h"
+#include "Misc/Paths.h"
+
+void UExampleGameFeaturePolicy::InitGameFeatureManager()
+{
+	UExampleAssetManager* AssetManager = Cast<UExampleAssetManager>(UAssetManager::GetIfInitialized());
+	if (!AssetManager)
+	{
+		Super::InitGameFeatureManager();
+		return;
+	}
+
+	const FExampleInclusionManifest& Manifest = AssetManager->GetInclusionManifest();
+	auto AdditionalFilter = [&Manifest](const FString& PluginFilename, const FGameFeaturePluginDetails& PluginDetails, FBuiltInGameFeaturePluginBehaviorOptions& OutOptions) -> bool
+	{
+		const FExampleInclusionManifestPlugin* Plugin = Manifest.FindPlugin(FPaths::GetBaseFilename(PluginFilename));
+		if (Plugin && Plugin->bShipped && !Plugin->bIncluded)
+		{
+			UE_LOG(LogTemp, Log, TEXT("GameFeature plugin %s shipped for live ops, registering it without activating"), *Plugin->Name);
+			OutOptions.AutoStateOverride = EBuiltInAutoState::Registered;
+		}
+		return true;
+	};
+	UGameFeaturesSubsystem::Get().LoadBuiltInGameFeaturePlugins(AdditionalFilter);
+}
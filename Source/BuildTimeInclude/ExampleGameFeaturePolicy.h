@@ -0,0 +1,26 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFeaturesProjectPolicies.h"
+#include "ExampleGameFeaturePolicy.generated.h"
+
+/**
+ * Loads built-in GameFeature plugins like the default policy, except for plugins that only shipped for live ops.
+ *
+ * BuildTimeIncludeTarget.ConfigureGameFeaturePlugins also enables plugins that are included at some version up to
+ * [MyGame] ExampleLiveOpsMaxVersion but not at the build's release version, and records them in the inclusion manifest
+ * as shipped but not included. Their BuiltInInitialFeatureState would activate them at startup, so they are only
+ * registered here. UExampleGameFeatureVersionSubsystem activates or preloads them when live ops switches versions.
+ *
+ * Set as GameFeaturesManagerClassName in DefaultGame.ini.
+ */
+UCLASS()
+class BUILDTIMEINCLUDE_API UExampleGameFeaturePolicy : public UDefaultGameFeaturesProjectPolicies
+{
+	GENERATED_BODY()
+
+public:
+	virtual void InitGameFeatureManager() override;
+};
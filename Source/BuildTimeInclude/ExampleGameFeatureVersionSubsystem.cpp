@@ -0,0 +1,307 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleGameFeatureVersionSubsystem.h"
+#include "ExampleAssetManager.h"
+#include "ExampleInclusionManifest.h"
+#include "GameFeaturesSubsystem.h"
+#include "Containers/Ticker.h"
+#include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "UObject/UObjectGlobals.h"
+
+static void ParseVersionAndRun(const TArray<FString>& Args, const TCHAR* CommandName, TFunctionRef<void(UExampleGameFeatureVersionSubsystem&, const FExampleVersion&)> Run)
+{
+	FExampleVersion Version;
+	if (Args.Num() < 1 || !UExampleAssetManager::TryParseReleaseVersion(Args[0], Version))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Usage: %s X.Y"), CommandName);
+		return;
+	}
+	if (UExampleGameFeatureVersionSubsystem* Subsystem = GEngine ? GEngine->GetEngineSubsystem<UExampleGameFeatureVersionSubsystem>() : nullptr)
+	{
+		Run(*Subsystem, Version);
+	}
+}
+
+static FAutoConsoleCommand ExampleSetActiveVersionCommand(
+	TEXT("Example.SetActiveVersion"),
+	TEXT("Switch GameFeature plugins to those included at a release version. Usage: Example.SetActiveVersion X.Y"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		ParseVersionAndRun(Args, TEXT("Example.SetActiveVersion"), [](UExampleGameFeatureVersionSubsystem& Subsystem, const FExampleVersion& Version) { Subsystem.SetActiveVersion(Version); });
+	}));
+
+static FAutoConsoleCommand ExamplePreloadVersionCommand(
+	TEXT("Example.PreloadVersion"),
+	TEXT("Load GameFeature plugins included at a release version in the background, without activating them. Usage: Example.PreloadVersion X.Y"),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		ParseVersionAndRun(Args, TEXT("Example.PreloadVersion"), [](UExampleGameFeatureVersionSubsystem& Subsystem, const FExampleVersion& Version) { Subsystem.PreloadVersion(Version); });
+	}));
+
+void UExampleGameFeatureVersionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Collection.InitializeDependency<UGameFeaturesSubsystem>();
+	Super::Initialize(Collection);
+}
+
+void UExampleGameFeatureVersionSubsystem::Deinitialize()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	Transition.Reset();
+	QueuedVersion.Reset();
+
+	Super::Deinitialize();
+}
+
+FExampleVersion UExampleGameFeatureVersionSubsystem::GetActiveVersion() const
+{
+	return ActiveVersion.IsSet() ? ActiveVersion.GetValue() : UExampleAssetManager::GetReleaseVersion();
+}
+
+void UExampleGameFeatureVersionSubsystem::GatherShippedPlugins(TArray<FVersionedPlugin>& OutPlugins) const
+{
+	UExampleAssetManager* AssetManager = Cast<UExampleAssetManager>(UAssetManager::GetIfInitialized());
+	if (!AssetManager)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Switching GameFeature plugins by version requires UExampleAssetManager"));
+		return;
+	}
+
+	const UGameFeaturesSubsystem& GameFeatures = UGameFeaturesSubsystem::Get();
+	for (const FExampleInclusionManifestPlugin& Plugin : AssetManager->GetInclusionManifest().Plugins)
+	{
+		FString PluginURL;
+		if (Plugin.bShipped && GameFeatures.GetPluginURLByName(Plugin.Name, PluginURL))
+		{
+			OutPlugins.Add({ Plugin.Name, MoveTemp(PluginURL), Plugin.VersionRange });
+		}
+	}
+}
+
+void UExampleGameFeatureVersionSubsystem::SetActiveVersion(const FExampleVersion& Version)
+{
+	if (Transition.IsSet())
+	{
+		UE_LOG(LogTemp, Display, TEXT("Switch to %s is in progress, switching to %s afterwards"), *Transition->Report.ToVersion.ToString(), *Version.ToString());
+		QueuedVersion = Version;
+		return;
+	}
+
+	if (Version == GetActiveVersion())
+	{
+		return;
+	}
+
+	BeginTransition(Version);
+}
+
+void UExampleGameFeatureVersionSubsystem::BeginTransition(const FExampleVersion& Version)
+{
+	TArray<FVersionedPlugin> Plugins;
+	GatherShippedPlugins(Plugins);
+
+	UGameFeaturesSubsystem& GameFeatures = UGameFeaturesSubsystem::Get();
+	TArray<FVersionedPlugin> OutgoingPlugins;
+	FTransition& NewTransition = Transition.Emplace();
+	NewTransition.Report.FromVersion = GetActiveVersion();
+	NewTransition.Report.ToVersion = Version;
+	NewTransition.StartSeconds = FPlatformTime::Seconds();
+	NewTransition.UsedPhysicalBefore = FPlatformMemory::GetStats().UsedPhysical;
+	for (FVersionedPlugin& Plugin : Plugins)
+	{
+		if (Plugin.VersionRange.DoesRangeInclude(Version))
+		{
+			if (!GameFeatures.IsGameFeaturePluginActive(Plugin.PluginURL, true))
+			{
+				NewTransition.IncomingPlugins.Add(MoveTemp(Plugin));
+			}
+		}
+		else if (GameFeatures.IsGameFeaturePluginLoaded(Plugin.PluginURL))
+		{
+			OutgoingPlugins.Add(MoveTemp(Plugin));
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Switching GameFeature plugins from %s to %s: %d to unload, %d to activate"),
+		*NewTransition.Report.FromVersion.ToString(), *Version.ToString(), OutgoingPlugins.Num(), NewTransition.IncomingPlugins.Num());
+
+	if (OutgoingPlugins.Num() == 0)
+	{
+		ActivatePlugins();
+		return;
+	}
+
+	// Unload all the way to Installed, so the plugin's content is unmounted and can be garbage collected.
+	// Completion may be reported synchronously, so count all requests before issuing any.
+	NewTransition.NumPendingRequests = OutgoingPlugins.Num();
+	for (const FVersionedPlugin& Plugin : OutgoingPlugins)
+	{
+		PreloadStartSeconds.Remove(Plugin.Name);
+		GameFeatures.ChangeGameFeatureTargetState(Plugin.PluginURL, EGameFeatureTargetState::Installed,
+			FGameFeaturePluginChangeStateComplete::CreateUObject(this, &UExampleGameFeatureVersionSubsystem::OnPluginUnloaded, Plugin.Name));
+	}
+}
+
+void UExampleGameFeatureVersionSubsystem::OnPluginUnloaded(const UE::GameFeatures::FResult& Result, FString PluginName)
+{
+	if (!Transition.IsSet())
+	{
+		return;
+	}
+
+	if (Result.HasError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to unload GameFeature plugin %s: %s"), *PluginName, *Result.GetError());
+		Transition->Report.FailedPlugins.Add(PluginName);
+	}
+	else
+	{
+		Transition->Report.DeactivatedPlugins.Add(PluginName);
+	}
+
+	if (--Transition->NumPendingRequests == 0)
+	{
+		Transition->Report.DeactivationSeconds = FPlatformTime::Seconds() - Transition->StartSeconds;
+
+		// Unloaded content is only freed by garbage collection. Purge fully so the measurement after it is complete.
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UExampleGameFeatureVersionSubsystem::OnPostGarbageCollect);
+		GEngine->ForceGarbageCollection(true);
+	}
+}
+
+void UExampleGameFeatureVersionSubsystem::OnPostGarbageCollect()
+{
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	PostGarbageCollectHandle.Reset();
+	if (!Transition.IsSet())
+	{
+		return;
+	}
+
+	Transition->Report.ReclaimedPhysicalBytes = static_cast<int64>(Transition->UsedPhysicalBefore) - static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+	UE_LOG(LogTemp, Display, TEXT("Unloaded %d GameFeature plugins in %.2f ms, reclaimed %.2f MiB of physical memory"),
+		Transition->Report.DeactivatedPlugins.Num(), Transition->Report.DeactivationSeconds * 1000.0, Transition->Report.ReclaimedPhysicalBytes / (1024.0 * 1024.0));
+
+	// Don't start plugin state changes from inside garbage collection
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+	{
+		ActivatePlugins();
+		return false;
+	}));
+}
+
+void UExampleGameFeatureVersionSubsystem::ActivatePlugins()
+{
+	if (!Transition.IsSet())
+	{
+		return;
+	}
+
+	if (Transition->IncomingPlugins.Num() == 0)
+	{
+		FinishTransition();
+		return;
+	}
+
+	UGameFeaturesSubsystem& GameFeatures = UGameFeaturesSubsystem::Get();
+	const TArray<FVersionedPlugin> IncomingPlugins = MoveTemp(Transition->IncomingPlugins);
+	Transition->NumPendingRequests = IncomingPlugins.Num();
+	for (const FVersionedPlugin& Plugin : IncomingPlugins)
+	{
+		Transition->ActivationStartSeconds.Add(Plugin.Name, FPlatformTime::Seconds());
+		if (GameFeatures.IsGameFeaturePluginLoaded(Plugin.PluginURL))
+		{
+			Transition->PreloadedPlugins.Add(Plugin.Name);
+		}
+	}
+	for (const FVersionedPlugin& Plugin : IncomingPlugins)
+	{
+		GameFeatures.ChangeGameFeatureTargetState(Plugin.PluginURL, EGameFeatureTargetState::Active,
+			FGameFeaturePluginChangeStateComplete::CreateUObject(this, &UExampleGameFeatureVersionSubsystem::OnPluginActivated, Plugin.Name));
+	}
+}
+
+void UExampleGameFeatureVersionSubsystem::OnPluginActivated(const UE::GameFeatures::FResult& Result, FString PluginName)
+{
+	if (!Transition.IsSet())
+	{
+		return;
+	}
+
+	const double ActivationSeconds = FPlatformTime::Seconds() - Transition->ActivationStartSeconds.FindRef(PluginName);
+	const bool bWasPreloaded = Transition->PreloadedPlugins.Contains(PluginName);
+	if (Result.HasError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to activate GameFeature plugin %s: %s"), *PluginName, *Result.GetError());
+		Transition->Report.FailedPlugins.Add(PluginName);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Display, TEXT("Activated GameFeature plugin %s in %.2f ms%s"), *PluginName, ActivationSeconds * 1000.0, bWasPreloaded ? TEXT(" (preloaded)") : TEXT(""));
+		Transition->Report.ActivatedPlugins.Add(PluginName);
+		Transition->Report.ActivationSeconds.Add(PluginName, ActivationSeconds);
+	}
+
+	if (--Transition->NumPendingRequests == 0)
+	{
+		FinishTransition();
+	}
+}
+
+void UExampleGameFeatureVersionSubsystem::FinishTransition()
+{
+	const FExampleVersionTransitionReport Report = MoveTemp(Transition->Report);
+	const double TotalSeconds = FPlatformTime::Seconds() - Transition->StartSeconds;
+	Transition.Reset();
+	ActiveVersion = Report.ToVersion;
+
+	UE_LOG(LogTemp, Display, TEXT("Switched GameFeature plugins from %s to %s in %.2f ms: %d unloaded, %d activated, %d failed, %.2f MiB reclaimed"),
+		*Report.FromVersion.ToString(), *Report.ToVersion.ToString(), TotalSeconds * 1000.0, Report.DeactivatedPlugins.Num(), Report.ActivatedPlugins.Num(),
+		Report.FailedPlugins.Num(), Report.ReclaimedPhysicalBytes / (1024.0 * 1024.0));
+	OnTransitionComplete.Broadcast(Report);
+
+	if (QueuedVersion.IsSet())
+	{
+		const FExampleVersion NextVersion = QueuedVersion.GetValue();
+		QueuedVersion.Reset();
+		SetActiveVersion(NextVersion);
+	}
+}
+
+void UExampleGameFeatureVersionSubsystem::PreloadVersion(const FExampleVersion& Version)
+{
+	TArray<FVersionedPlugin> Plugins;
+	GatherShippedPlugins(Plugins);
+
+	UGameFeaturesSubsystem& GameFeatures = UGameFeaturesSubsystem::Get();
+	for (const FVersionedPlugin& Plugin : Plugins)
+	{
+		if (!Plugin.VersionRange.DoesRangeInclude(Version) || GameFeatures.IsGameFeaturePluginLoaded(Plugin.PluginURL) || PreloadStartSeconds.Contains(Plugin.Name))
+		{
+			continue;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("Preloading GameFeature plugin %s for %s"), *Plugin.Name, *Version.ToString());
+		PreloadStartSeconds.Add(Plugin.Name, FPlatformTime::Seconds());
+		GameFeatures.ChangeGameFeatureTargetState(Plugin.PluginURL, EGameFeatureTargetState::Loaded,
+			FGameFeaturePluginChangeStateComplete::CreateUObject(this, &UExampleGameFeatureVersionSubsystem::OnPluginPreloaded, Plugin.Name));
+	}
+}
+
+void UExampleGameFeatureVersionSubsystem::OnPluginPreloaded(const UE::GameFeatures::FResult& Result, FString PluginName)
+{
+	// Forget the request either way. Whether the plugin is loaded is the subsystem's state to track, and a stale entry
+	// would make PreloadVersion skip the plugin for good once it has been unloaded again.
+	double StartSeconds = 0.0;
+	const bool bWasPending = PreloadStartSeconds.RemoveAndCopyValue(PluginName, StartSeconds);
+	if (Result.HasError())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to preload GameFeature plugin %s: %s"), *PluginName, *Result.GetError());
+	}
+	else if (bWasPending)
+	{
+		UE_LOG(LogTemp, Display, TEXT("Preloaded GameFeature plugin %s in %.2f ms"), *PluginName, (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+	}
+}
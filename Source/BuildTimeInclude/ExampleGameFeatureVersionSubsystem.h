@@ -0,0 +1,102 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "GameFeaturePluginOperationResult.h"
+#include "ExampleVersionRange.h"
+#include "ExampleGameFeatureVersionSubsystem.generated.h"
+
+// Outcome of one UExampleGameFeatureVersionSubsystem::SetActiveVersion call
+struct FExampleVersionTransitionReport
+{
+	FExampleVersion FromVersion;
+	FExampleVersion ToVersion;
+	TArray<FString> DeactivatedPlugins;
+	TArray<FString> ActivatedPlugins;
+	TArray<FString> FailedPlugins;
+	// Used physical memory before deactivating minus after the full garbage collection that follows. Negative if usage grew.
+	int64 ReclaimedPhysicalBytes = 0;
+	double DeactivationSeconds = 0.0;
+	// Per plugin from request to Active. Plugins that were preloaded through PreloadVersion only pay for activation here.
+	TMap<FString, double> ActivationSeconds;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FExampleVersionTransitionComplete, const FExampleVersionTransitionReport&);
+
+/**
+ * Switches the GameFeature plugins of a running game or server to another release version without a restart.
+ *
+ * The build decides which GameFeature plugins ship (BuildTimeIncludeTarget.ConfigureGameFeaturePlugins) and records
+ * their version ranges in the inclusion manifest. Besides the plugins of the release version, the build ships those
+ * included at any version up to [MyGame] ExampleLiveOpsMaxVersion, registered but not active (UExampleGameFeaturePolicy).
+ * At runtime the active version starts out as the release version.
+ * SetActiveVersion unloads shipped plugins whose range excludes the new version, runs a full garbage collection to
+ * measure the memory reclaimed and then activates the plugins whose range includes it. PreloadVersion loads the next
+ * version's plugins in the background ahead of time, so the switch itself only has to activate them. A plugin can only
+ * be activated if it shipped, so versions past the live ops window only get the shipped plugins that still include them.
+ *
+ * Only GameFeature plugins are switched. Cooked content and UExampleAssetManager::GetReleaseVersion keep following the
+ * version the build was made for.
+ *
+ * Console: Example.SetActiveVersion X.Y, Example.PreloadVersion X.Y
+ */
+UCLASS()
+class BUILDTIMEINCLUDE_API UExampleGameFeatureVersionSubsystem : public UEngineSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	FExampleVersion GetActiveVersion() const;
+
+	// Deactivate and unload plugins excluded at Version, then activate the ones included. Requests made while a
+	// transition is in progress are applied after it, only the latest one is kept.
+	void SetActiveVersion(const FExampleVersion& Version);
+
+	// Load, but don't activate, the shipped plugins included at Version that aren't loaded yet
+	void PreloadVersion(const FExampleVersion& Version);
+
+	bool IsTransitionInProgress() const { return Transition.IsSet(); }
+
+	FExampleVersionTransitionComplete OnTransitionComplete;
+
+private:
+	struct FVersionedPlugin
+	{
+		FString Name;
+		FString PluginURL;
+		FExampleVersionRange VersionRange;
+	};
+	// Manifest plugins that shipped with this build
+	void GatherShippedPlugins(TArray<FVersionedPlugin>& OutPlugins) const;
+
+	void BeginTransition(const FExampleVersion& Version);
+	void OnPluginUnloaded(const UE::GameFeatures::FResult& Result, FString PluginName);
+	void OnPostGarbageCollect();
+	void ActivatePlugins();
+	void OnPluginActivated(const UE::GameFeatures::FResult& Result, FString PluginName);
+	void OnPluginPreloaded(const UE::GameFeatures::FResult& Result, FString PluginName);
+	void FinishTransition();
+
+	struct FTransition
+	{
+		FExampleVersionTransitionReport Report;
+		TArray<FVersionedPlugin> IncomingPlugins;
+		int32 NumPendingRequests = 0;
+		double StartSeconds = 0.0;
+		uint64 UsedPhysicalBefore = 0;
+		TMap<FString, double> ActivationStartSeconds;
+		TSet<FString> PreloadedPlugins;
+	};
+	TOptional<FTransition> Transition;
+
+	TOptional<FExampleVersion> ActiveVersion;
+	TOptional<FExampleVersion> QueuedVersion;
+	// Preloads still in flight, so PreloadVersion doesn't request them twice
+	TMap<FString, double> PreloadStartSeconds;
+	FDelegateHandle PostGarbageCollectHandle;
+};
@@ -0,0 +1,529 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleInclusionBenchmarkCommandlet.h"
+#include "ExampleAssetManager.h"
+#include "ExampleVersionRangeCache.h"
+#include "ExampleVersionRangeTable.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Dom/JsonObject.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformMemory.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include <atomic>
+
+namespace ExampleInclusionBenchmark
+{
+	struct FSettings
+	{
+		TArray<int32> Sizes{ 10000, 100000, 1000000 };
+		int32 DistinctRanges = 32;
+		float SunsetRatio = 0.3f;
+		TArray<TPair<FName, float>> TypeMix{ { FName("ExampleActor"), 0.7f }, { FName("ExampleDataAsset"), 0.3f } };
+		int32 ClassesPerType = 64;
+		int32 Seed = 1;
+	};
+
+	// The range check as it was implemented before packed keys, kept here as the baseline
+	static int8 LegacyCompare(const FExampleVersion& Reference, const FExampleVersion& Value)
+	{
+		const int8 Sign = FMath::Sign<int8>(Value.MajorVersion - Reference.MajorVersion);
+		return Sign != 0 ? Sign : FMath::Sign<int8>(Value.MinorVersion - Reference.MinorVersion);
+	}
+
+	static bool LegacyDoesRangeInclude(const FExampleVersionRange& Range, const FExampleVersion& Version)
+	{
+		return (LegacyCompare(Range.IntroVersion, Version) >= 0) && (!Range.bHasSunsetVersion || LegacyCompare(Range.SunsetVersion, Version) < 0);
+	}
+
+	static FExampleVersion RandomVersion(FRandomStream& Random)
+	{
+		return FExampleVersion(Random.RandRange(1, 10), Random.RandRange(0, 9));
+	}
+
+	static TArray<FExampleVersionRange> GenerateRangePool(const FSettings& Settings, FRandomStream& Random)
+	{
+		TArray<FExampleVersionRange> Pool;
+		for (int32 Index = 0; Index < FMath::Max(Settings.DistinctRanges, 1); ++Index)
+		{
+			FExampleVersionRange Range;
+			Range.IntroVersion = RandomVersion(Random);
+			Range.bHasSunsetVersion = Random.FRand() < Settings.SunsetRatio;
+			if (Range.bHasSunsetVersion)
+			{
+				Range.SunsetVersion = FExampleVersion(Range.IntroVersion.MajorVersion + Random.RandRange(0, 3), Random.RandRange(0, 9));
+			}
+			Pool.Add(Range);
+		}
+		return Pool;
+	}
+
+	// Index into Settings.TypeMix, weighted
+	static int32 PickTypeIndex(const FSettings& Settings, FRandomStream& Random)
+	{
+		float TotalWeight = 0.f;
+		for (const TPair<FName, float>& Entry : Settings.TypeMix)
+		{
+			TotalWeight += Entry.Value;
+		}
+
+		float Pick = Random.FRand() * TotalWeight;
+		for (int32 TypeIndex = 0; TypeIndex < Settings.TypeMix.Num(); ++TypeIndex)
+		{
+			Pick -= Settings.TypeMix[TypeIndex].Value;
+			if (Pick <= 0.f)
+			{
+				return TypeIndex;
+			}
+		}
+		return Settings.TypeMix.Num() - 1;
+	}
+
+	// Placed actor instances for the PostLoad filter. Each type of the mix gets ClassesPerType classes with a range from the
+	// pool, each instance picks a type by weight and one of its classes, and carries its class's range like a placed actor does.
+	static void GenerateActorInstances(int32 NumInstances, const FSettings& Settings, TConstArrayView<FExampleVersionRange> RangePool, FRandomStream& Random,
+		TArray<FExampleVersionRange>& OutInstanceRanges)
+	{
+		const int32 ClassesPerType = FMath::Max(Settings.ClassesPerType, 1);
+		TArray<FExampleVersionRange> ClassRanges;
+		ClassRanges.Reserve(Settings.TypeMix.Num() * ClassesPerType);
+		for (int32 ClassIndex = 0; ClassIndex < Settings.TypeMix.Num() * ClassesPerType; ++ClassIndex)
+		{
+			ClassRanges.Add(RangePool[Random.RandHelper(RangePool.Num())]);
+		}
+
+		OutInstanceRanges.Reset(NumInstances);
+		for (int32 Index = 0; Index < NumInstances; ++Index)
+		{
+			const int32 TypeIndex = PickTypeIndex(Settings, Random);
+			OutInstanceRanges.Add(ClassRanges[TypeIndex * ClassesPerType + Random.RandHelper(ClassesPerType)]);
+		}
+	}
+
+	// Asset data as the registry would hold it, with the tags the label pass reads
+	static void GenerateAssets(int32 NumAssets, const FSettings& Settings, TConstArrayView<FString> TagValuePool, FRandomStream& Random, TArray<FAssetData>& OutAssets)
+	{
+		static const FTopLevelAssetPath AssetClassPath(TEXT("/Script/BuildTimeInclude"), TEXT("ExampleDataAsset"));
+		OutAssets.Reset(NumAssets);
+		for (int32 Index = 0; Index < NumAssets; ++Index)
+		{
+			const FName PrimaryAssetType = Settings.TypeMix[PickTypeIndex(Settings, Random)].Key;
+			const FName AssetName(*FString::Printf(TEXT("Synthetic_%d"), Index));
+			const FName PackageName(*FString::Printf(TEXT("/Game/Synthetic/%s/Synthetic_%d"), *PrimaryAssetType.ToString(), Index));
+
+			FAssetDataTagMap Tags;
+			Tags.Add(FExampleVersionRange::AssetTagName, TagValuePool[Random.RandHelper(TagValuePool.Num())]);
+			Tags.Add(FPrimaryAssetId::PrimaryAssetTypeTag, PrimaryAssetType.ToString());
+			Tags.Add(FPrimaryAssetId::PrimaryAssetNameTag, AssetName.ToString());
+			OutAssets.Emplace(PackageName, FName(*FPaths::GetPath(PackageName.ToString())), AssetName, AssetClassPath, MoveTemp(Tags));
+		}
+	}
+
+	// Forwards to the allocator it replaces and counts every allocation made on any thread while it's installed. Installed
+	// for the whole benchmark and never deleted: blocks allocated through it are freed by the wrapped allocator directly.
+	class FCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit FCountingMalloc(FMalloc* InInner)
+			: Inner(InInner)
+		{
+		}
+
+		virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			NumAllocations.fetch_add(1, std::memory_order_relaxed);
+			NumBytes.fetch_add(Count, std::memory_order_relaxed);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			if (Count > 0)
+			{
+				NumAllocations.fetch_add(1, std::memory_order_relaxed);
+				NumBytes.fetch_add(Count, std::memory_order_relaxed);
+			}
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		virtual void Free(void* Original) override { Inner->Free(Original); }
+		virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+		virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+		virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+		virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+		virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+		virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+		virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+		virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+		virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+		virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+		FMalloc* GetInner() const { return Inner; }
+		uint64 GetNumAllocations() const { return NumAllocations.load(std::memory_order_relaxed); }
+		uint64 GetAllocatedBytes() const { return NumBytes.load(std::memory_order_relaxed); }
+
+	private:
+		FMalloc* Inner;
+		std::atomic<uint64> NumAllocations{ 0 };
+		std::atomic<uint64> NumBytes{ 0 };
+	};
+
+	// Installed by Main, nullptr if allocations aren't counted
+	static FCountingMalloc* GCountingMalloc = nullptr;
+
+	// Wall time, allocations and memory growth of one stage
+	class FStageTimer
+	{
+	public:
+		FStageTimer(TSharedRef<FJsonObject> InStages, const TCHAR* InName)
+			: Stages(InStages), Name(InName), StartUsedPhysical(FPlatformMemory::GetStats().UsedPhysical)
+			, StartNumAllocations(GCountingMalloc ? GCountingMalloc->GetNumAllocations() : 0)
+			, StartAllocatedBytes(GCountingMalloc ? GCountingMalloc->GetAllocatedBytes() : 0)
+			, StartTime(FPlatformTime::Seconds())
+		{
+		}
+
+		~FStageTimer()
+		{
+			const double Seconds = FPlatformTime::Seconds() - StartTime;
+			const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+			TSharedRef<FJsonObject> Stage = MakeShared<FJsonObject>();
+			Stage->SetNumberField(TEXT("seconds"), Seconds);
+			Stage->SetNumberField(TEXT("used_physical_delta_bytes"), (double)((int64)MemoryStats.UsedPhysical - (int64)StartUsedPhysical));
+			if (GCountingMalloc)
+			{
+				const uint64 NumAllocations = GCountingMalloc->GetNumAllocations() - StartNumAllocations;
+				Stage->SetNumberField(TEXT("allocations"), (double)NumAllocations);
+				Stage->SetNumberField(TEXT("allocated_bytes"), (double)(GCountingMalloc->GetAllocatedBytes() - StartAllocatedBytes));
+				UE_LOG(LogTemp, Display, TEXT("    %-32s %10.3f ms %12llu allocations"), Name, Seconds * 1000.0, NumAllocations);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Display, TEXT("    %-32s %10.3f ms"), Name, Seconds * 1000.0);
+			}
+			Stages->SetObjectField(Name, Stage);
+		}
+
+	private:
+		TSharedRef<FJsonObject> Stages;
+		const TCHAR* Name;
+		uint64 StartUsedPhysical;
+		uint64 StartNumAllocations;
+		uint64 StartAllocatedBytes;
+		double StartTime;
+	};
+
+	static TSharedRef<FJsonObject> RunBenchmark(int32 NumAssets, const FSettings& Settings)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  %d assets:"), NumAssets);
+		const uint64 StartUsedPhysical = FPlatformMemory::GetStats().UsedPhysical;
+		const uint64 StartAllocatedBytes = GCountingMalloc ? GCountingMalloc->GetAllocatedBytes() : 0;
+		FRandomStream Random(Settings.Seed);
+		const FExampleVersion ReleaseVersion = RandomVersion(Random);
+
+		TArray<FExampleVersionRange> RangePool = GenerateRangePool(Settings, Random);
+		TArray<FString> TagValuePool;
+		for (const FExampleVersionRange& Range : RangePool)
+		{
+			TagValuePool.Add(FExampleVersionRange::ToAssetTagValue(Range));
+		}
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		TSharedRef<FJsonObject> Stages = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("num_assets"), NumAssets);
+		Result->SetStringField(TEXT("release_version"), ReleaseVersion.ToString());
+
+		TArray<FAssetData> Assets;
+		{
+			FStageTimer Timer(Stages, TEXT("generate_registry"));
+			GenerateAssets(NumAssets, Settings, TagValuePool, Random, Assets);
+		}
+
+		// The same ranges in the struct text form assets carried before the compact tag encoding
+		TArray<FString> TagValues, LegacyTagValues;
+		TagValues.Reserve(Assets.Num());
+		LegacyTagValues.Reserve(Assets.Num());
+		int64 TagBytes = 0, LegacyTagBytes = 0;
+		for (const FAssetData& AssetData : Assets)
+		{
+			TagValues.Add(AssetData.GetTagValueRef<FString>(FExampleVersionRange::AssetTagName));
+			LegacyTagValues.Add(FExampleVersionRange::ToLegacyAssetTagValue(FExampleVersionRange::FromAssetTagValue(TagValues.Last())));
+			TagBytes += TagValues.Last().Len();
+			LegacyTagBytes += LegacyTagValues.Last().Len();
+		}
+		Result->SetNumberField(TEXT("tag_value_bytes_compact"), (double)TagBytes);
+		Result->SetNumberField(TEXT("tag_value_bytes_legacy"), (double)LegacyTagBytes);
+
+		// Tag decoding: what every asset paid before, against the fast parser on both encodings
+		TArray<FExampleVersionRange> Ranges;
+		Ranges.SetNum(Assets.Num());
+		{
+			FStageTimer Timer(Stages, TEXT("decode_import_text"));
+			for (int32 Index = 0; Index < LegacyTagValues.Num(); ++Index)
+			{
+				FExampleVersionRange::StaticStruct()->ImportText(*LegacyTagValues[Index], &Ranges[Index], nullptr, 0, nullptr, TEXT(""));
+			}
+		}
+		{
+			FStageTimer Timer(Stages, TEXT("decode_fast_parser_legacy"));
+			for (int32 Index = 0; Index < LegacyTagValues.Num(); ++Index)
+			{
+				FExampleVersionRange::TryParseAssetTagValue(LegacyTagValues[Index], Ranges[Index]);
+			}
+		}
+		{
+			FStageTimer Timer(Stages, TEXT("decode_fast_parser"));
+			for (int32 Index = 0; Index < TagValues.Num(); ++Index)
+			{
+				FExampleVersionRange::TryParseAssetTagValue(TagValues[Index], Ranges[Index]);
+			}
+		}
+
+		// Shipped side table: size, load from its serialized form and runtime lookups
+		{
+			TArray<FPrimaryAssetId> AssetIds;
+			AssetIds.Reserve(Assets.Num());
+			for (const FAssetData& AssetData : Assets)
+			{
+				AssetIds.Add(AssetData.GetPrimaryAssetId());
+			}
+
+			FExampleVersionRangeTable Table;
+			{
+				FStageTimer Timer(Stages, TEXT("range_table_build"));
+				Table.Build(AssetIds, Ranges);
+			}
+			TArray<uint8> TableBytes;
+			FMemoryWriter TableWriter(TableBytes);
+			Table.Serialize(TableWriter);
+			Result->SetNumberField(TEXT("range_table_file_bytes"), TableBytes.Num());
+			Result->SetNumberField(TEXT("range_table_allocated_bytes"), (double)Table.GetAllocatedSize());
+			{
+				FStageTimer Timer(Stages, TEXT("range_table_load"));
+				FMemoryReader TableReader(TableBytes);
+				Table.Serialize(TableReader);
+			}
+			int32 NumFound = 0;
+			{
+				FStageTimer Timer(Stages, TEXT("range_table_lookup"));
+				FExampleVersionRange Range;
+				for (const FPrimaryAssetId& AssetId : AssetIds)
+				{
+					NumFound += Table.TryGetVersionRange(AssetId, Range) ? 1 : 0;
+				}
+			}
+			Result->SetNumberField(TEXT("range_table_num_found"), NumFound);
+		}
+
+		// Full evaluation as the label pass runs it, including tag lookup and the decode cache
+		TArray<FExampleAssetInclusionDecision> Decisions;
+		{
+			FExampleVersionRangeDecodeCache DecodeCache;
+			FStageTimer Timer(Stages, TEXT("evaluate_serial"));
+			UExampleAssetManager::EvaluateVersionedAssets(Assets, ReleaseVersion, DecodeCache, false, Decisions);
+		}
+		{
+			FExampleVersionRangeDecodeCache DecodeCache;
+			FStageTimer Timer(Stages, TEXT("evaluate_parallel"));
+			UExampleAssetManager::EvaluateVersionedAssets(Assets, ReleaseVersion, DecodeCache, true, Decisions);
+		}
+
+		// Range checks only. Counting keeps the compiler from dropping the loops.
+		int32 NumIncludedLegacy = 0, NumIncluded = 0, NumIncludedBatch = 0;
+		{
+			FStageTimer Timer(Stages, TEXT("range_legacy_compare"));
+			for (const FExampleVersionRange& Range : Ranges)
+			{
+				NumIncludedLegacy += LegacyDoesRangeInclude(Range, ReleaseVersion) ? 1 : 0;
+			}
+		}
+		{
+			FStageTimer Timer(Stages, TEXT("range_packed_key"));
+			for (const FExampleVersionRange& Range : Ranges)
+			{
+				NumIncluded += Range.DoesRangeInclude(ReleaseVersion) ? 1 : 0;
+			}
+		}
+		{
+			FExampleVersionRangeBatch Batch;
+			Batch.Reserve(Ranges.Num());
+			for (const FExampleVersionRange& Range : Ranges)
+			{
+				Batch.Add(Range);
+			}
+			TArray<uint8> Included;
+			Included.SetNumUninitialized(Batch.Num());
+
+			FStageTimer Timer(Stages, TEXT("range_soa_batch"));
+			Batch.Evaluate(ReleaseVersion, Included.GetData());
+			for (uint8 bIncluded : Included)
+			{
+				NumIncludedBatch += bIncluded;
+			}
+		}
+		if (NumIncludedLegacy != NumIncluded || NumIncluded != NumIncludedBatch)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Range implementations disagree: legacy %d, packed key %d, batch %d"), NumIncludedLegacy, NumIncluded, NumIncludedBatch);
+		}
+		Result->SetNumberField(TEXT("num_included"), NumIncluded);
+
+		// Synthetic stand-in for the rule commit of the label pass: the generated assets aren't known to the asset manager,
+		// so the rules go into a local map instead of SetPrimaryAssetRules. Doesn't include the journal or chunk assignment.
+		{
+			TMap<FPrimaryAssetId, FPrimaryAssetRules> CommittedRules;
+			FStageTimer Timer(Stages, TEXT("commit_rules_synthetic"));
+			CommittedRules.Reserve(Assets.Num());
+			for (int32 Index = 0; Index < Assets.Num(); ++Index)
+			{
+				FPrimaryAssetRules Rules;
+				Rules.CookRule = Decisions[Index].bShouldInclude ? EPrimaryAssetCookRule::AlwaysCook : EPrimaryAssetCookRule::NeverCook;
+				CommittedRules.Add(Assets[Index].GetPrimaryAssetId(), Rules);
+			}
+		}
+
+		// Actor PostLoad filter, one check per placed instance. The baseline checks the range against a version already in
+		// hand, the filter goes through the shared release version like PostLoad does.
+		{
+			TArray<FExampleVersionRange> InstanceRanges;
+			GenerateActorInstances(NumAssets, Settings, RangePool, Random, InstanceRanges);
+			Result->SetNumberField(TEXT("num_actor_classes"), Settings.TypeMix.Num() * FMath::Max(Settings.ClassesPerType, 1));
+
+			const FExampleVersion PostLoadReleaseVersion = UExampleAssetManager::GetReleaseVersion();
+			int32 NumTransientBaseline = 0, NumTransient = 0;
+			{
+				FStageTimer Timer(Stages, TEXT("postload_direct_baseline"));
+				for (const FExampleVersionRange& InstanceRange : InstanceRanges)
+				{
+					NumTransientBaseline += InstanceRange.DoesRangeInclude(PostLoadReleaseVersion) ? 0 : 1;
+				}
+			}
+			{
+				FStageTimer Timer(Stages, TEXT("postload_shared_release_version"));
+				for (const FExampleVersionRange& InstanceRange : InstanceRanges)
+				{
+					NumTransient += UExampleAssetManager::DoesVersionRangeInclude(InstanceRange) ? 0 : 1;
+				}
+			}
+			if (NumTransientBaseline != NumTransient)
+			{
+				UE_LOG(LogTemp, Error, TEXT("PostLoad filter disagrees with its baseline: %d vs. %d transient instances"), NumTransient, NumTransientBaseline);
+			}
+			Result->SetNumberField(TEXT("num_transient_instances"), NumTransient);
+		}
+
+		// Per size, the process wide peaks carry over from earlier sizes of the same run
+		Result->SetNumberField(TEXT("used_physical_delta_bytes"), (double)((int64)FPlatformMemory::GetStats().UsedPhysical - (int64)StartUsedPhysical));
+		if (GCountingMalloc)
+		{
+			Result->SetNumberField(TEXT("allocated_bytes"), (double)(GCountingMalloc->GetAllocatedBytes() - StartAllocatedBytes));
+		}
+		Result->SetObjectField(TEXT("stages"), Stages);
+		return Result;
+	}
+}
+
+UExampleInclusionBenchmarkCommandlet::UExampleInclusionBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UExampleInclusionBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace ExampleInclusionBenchmark;
+
+	FSettings Settings;
+	FString SizesParam;
+	if (FParse::Value(*Params, TEXT("Sizes="), SizesParam, false))
+	{
+		TArray<FString> SizeTokens;
+		SizesParam.ParseIntoArray(SizeTokens, TEXT(","));
+		Settings.Sizes.Reset();
+		for (const FString& SizeToken : SizeTokens)
+		{
+			Settings.Sizes.Add(FMath::Max(FCString::Atoi(*SizeToken), 1));
+		}
+	}
+
+	FString TypeMixParam;
+	if (FParse::Value(*Params, TEXT("TypeMix="), TypeMixParam, false))
+	{
+		TArray<FString> TypeTokens;
+		TypeMixParam.ParseIntoArray(TypeTokens, TEXT(","));
+		Settings.TypeMix.Reset();
+		for (const FString& TypeToken : TypeTokens)
+		{
+			FString TypeName, Weight;
+			if (!TypeToken.Split(TEXT(":"), &TypeName, &Weight))
+			{
+				TypeName = TypeToken;
+				Weight = TEXT("1");
+			}
+			Settings.TypeMix.Emplace(FName(*TypeName), FMath::Max(FCString::Atof(*Weight), 0.f));
+		}
+	}
+	if (Settings.Sizes.IsEmpty() || Settings.TypeMix.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("-Sizes= and -TypeMix= must not be empty."));
+		return 1;
+	}
+
+	FParse::Value(*Params, TEXT("DistinctRanges="), Settings.DistinctRanges);
+	FParse::Value(*Params, TEXT("SunsetRatio="), Settings.SunsetRatio);
+	FParse::Value(*Params, TEXT("ClassesPerType="), Settings.ClassesPerType);
+	FParse::Value(*Params, TEXT("Seed="), Settings.Seed);
+
+	FString Label;
+	FParse::Value(*Params, TEXT("Label="), Label);
+	FString OutputFilename = FPaths::ProjectSavedDir() / TEXT("ExampleInclusion") / TEXT("Benchmark.json");
+	FParse::Value(*Params, TEXT("Output="), OutputFilename);
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("label"), Label);
+	Report->SetStringField(TEXT("platform"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	Report->SetNumberField(TEXT("num_worker_threads"), FTaskGraphInterface::Get().GetNumWorkerThreads());
+	Report->SetNumberField(TEXT("distinct_ranges"), Settings.DistinctRanges);
+	Report->SetNumberField(TEXT("sunset_ratio"), Settings.SunsetRatio);
+	Report->SetNumberField(TEXT("classes_per_type"), Settings.ClassesPerType);
+	Report->SetNumberField(TEXT("seed"), Settings.Seed);
+
+	// Count allocations per stage unless -NoAllocationCounts. Adds an atomic increment to every allocation of the process.
+	const bool bCountAllocations = !FParse::Param(*Params, TEXT("NoAllocationCounts"));
+	if (bCountAllocations)
+	{
+		GCountingMalloc = new FCountingMalloc(GMalloc);
+		GMalloc = GCountingMalloc;
+	}
+	Report->SetBoolField(TEXT("allocation_counts"), bCountAllocations);
+
+	UE_LOG(LogTemp, Display, TEXT("Running inclusion pipeline benchmark"));
+	TArray<TSharedPtr<FJsonValue>> Runs;
+	for (const int32 NumAssets : Settings.Sizes)
+	{
+		Runs.Add(MakeShared<FJsonValueObject>(RunBenchmark(NumAssets, Settings)));
+	}
+	Report->SetArrayField(TEXT("runs"), Runs);
+
+	if (GCountingMalloc)
+	{
+		GMalloc = GCountingMalloc->GetInner();
+		GCountingMalloc = nullptr;
+	}
+
+	FString Json;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	if (!FJsonSerializer::Serialize(Report, Writer) || !FFileHelper::SaveStringToFile(Json, *OutputFilename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write benchmark results to '%s'."), *OutputFilename);
+		return 1;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Wrote benchmark results to '%s'"), *OutputFilename);
+	return 0;
+}
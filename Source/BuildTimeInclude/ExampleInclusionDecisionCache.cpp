@@ -0,0 +1,130 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleInclusionDecisionCache.h"
+#include "ExampleAssetManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace ExampleInclusionDecisionCache
+{
+	static constexpr uint32 FileMagic = 0x43445845; // 'EXDC'
+	static constexpr uint32 FileVersion = 3;
+}
+
+bool FExampleInclusionDecisionCache::LoadFromFile(const FString& Filename)
+{
+	*this = FExampleInclusionDecisionCache();
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Reader)
+	{
+		// First cook, nothing to reuse
+		return false;
+	}
+
+	Serialize(*Reader);
+	if (Reader->IsError())
+	{
+		UE_LOG(LogTemp, Log, TEXT("Ignoring outdated or corrupt inclusion decision cache '%s'."), *Filename);
+		*this = FExampleInclusionDecisionCache();
+		return false;
+	}
+	return true;
+}
+
+bool FExampleInclusionDecisionCache::SaveToFile(const FString& Filename) const
+{
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Writer)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to open inclusion decision cache '%s' for writing."), *Filename);
+		return false;
+	}
+
+	const_cast<FExampleInclusionDecisionCache*>(this)->Serialize(*Writer);
+	return Writer->Close();
+}
+
+void FExampleInclusionDecisionCache::RecordDecisions(const FExampleVersion& InReleaseVersion, TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions,
+	TArray<FName>& OutIncludedPackages, TArray<FName>& OutExcludedPackages)
+{
+	check(Assets.Num() == Decisions.Num());
+	OutIncludedPackages.Reset();
+	OutExcludedPackages.Reset();
+
+	TMap<FPrimaryAssetId, FEntry> NewEntries;
+	NewEntries.Reserve(Assets.Num());
+	for (int32 Index = 0; Index < Assets.Num(); ++Index)
+	{
+		const FExampleAssetInclusionDecision& Decision = Decisions[Index];
+		if (!Decision.bHasVersionRange)
+		{
+			continue;
+		}
+
+		const FPrimaryAssetId AssetId = Assets[Index].GetPrimaryAssetId();
+		FEntry& Entry = NewEntries.Add(AssetId);
+		Entry.PackageName = Assets[Index].PackageName;
+		Entry.bIncluded = Decision.bShouldInclude;
+
+		// Compare against the previous cook regardless of its release version, switching versions is the most common reason to flip
+		const FEntry* PreviousEntry = Entries.Find(AssetId);
+		if (PreviousEntry && PreviousEntry->bIncluded != Entry.bIncluded)
+		{
+			(Entry.bIncluded ? OutIncludedPackages : OutExcludedPackages).Add(Entry.PackageName);
+		}
+	}
+
+	ReleaseVersion = InReleaseVersion;
+	Entries = MoveTemp(NewEntries);
+}
+
+FString FExampleInclusionDecisionCache::GetDefaultFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ExampleInclusion") / TEXT("DecisionCache.bin");
+}
+
+void FExampleInclusionDecisionCache::Serialize(FArchive& Ar)
+{
+	uint32 Magic = ExampleInclusionDecisionCache::FileMagic;
+	uint32 Version = ExampleInclusionDecisionCache::FileVersion;
+	Ar << Magic << Version;
+	if (Magic != ExampleInclusionDecisionCache::FileMagic || Version != ExampleInclusionDecisionCache::FileVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	Ar << ReleaseVersion;
+
+	// Names are written as strings, FName serialization isn't portable for plain file archives
+	int32 NumEntries = Entries.Num();
+	Ar << NumEntries;
+	if (Ar.IsLoading())
+	{
+		if (NumEntries < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		Entries.Reserve(NumEntries);
+		for (int32 Index = 0; Index < NumEntries && !Ar.IsError(); ++Index)
+		{
+			FString Type, Name, PackageName;
+			FEntry Entry;
+			Ar << Type << Name << PackageName << Entry.bIncluded;
+			Entry.PackageName = FName(*PackageName);
+			Entries.Add(FPrimaryAssetId(FPrimaryAssetType(*Type), FName(*Name)), MoveTemp(Entry));
+		}
+	}
+	else
+	{
+		for (TPair<FPrimaryAssetId, FEntry>& Pair : Entries)
+		{
+			FString Type = Pair.Key.PrimaryAssetType.ToString();
+			FString Name = Pair.Key.PrimaryAssetName.ToString();
+			FString PackageName = Pair.Value.PackageName.ToString();
+			Ar << Type << Name << PackageName << Pair.Value.bIncluded;
+		}
+	}
+}
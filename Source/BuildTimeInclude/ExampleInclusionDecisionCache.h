@@ -0,0 +1,46 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/PrimaryAssetId.h"
+#include "ExampleVersionRange.h"
+
+struct FExampleAssetInclusionDecision;
+
+/**
+ * On-disk record of which primary assets the previous cook included, to report the packages that flipped between
+ * included and excluded since. Those are the only packages whose cooked output needs to be redone because of versioning.
+ *
+ * Decisions aren't reused from it: a decision costs two packed version compares once the tag is decoded, less than
+ * looking the asset up here, and the tag has to be read either way to know whether it changed.
+ */
+class BUILDTIMEINCLUDE_API FExampleInclusionDecisionCache
+{
+public:
+	struct FEntry
+	{
+		FName PackageName;
+		bool bIncluded = false;
+	};
+
+	// Load the decisions of the previous cook. A missing or outdated file results in an empty cache.
+	bool LoadFromFile(const FString& Filename);
+	bool SaveToFile(const FString& Filename) const;
+
+	// Replace the cached decisions by the ones of this cook. Returns the packages whose inclusion flipped since the previous cook,
+	// assets that are new to the cache are not reported.
+	void RecordDecisions(const FExampleVersion& ReleaseVersion, TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions,
+		TArray<FName>& OutIncludedPackages, TArray<FName>& OutExcludedPackages);
+
+	// Default location, relative to the project's Saved directory
+	static FString GetDefaultFilename();
+
+private:
+	void Serialize(FArchive& Ar);
+
+	// Release version the cached decisions were made for
+	FExampleVersion ReleaseVersion;
+	TMap<FPrimaryAssetId, FEntry> Entries;
+};
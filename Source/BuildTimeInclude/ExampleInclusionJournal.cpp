@@ -0,0 +1,233 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleInclusionJournal.h"
+#include "ExampleAssetManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/Paths.h"
+#include "Containers/Queue.h"
+#include <atomic>
+
+namespace ExampleInclusionJournal
+{
+	// Hand lines over to the writer thread in chunks of about this many characters
+	static constexpr int32 FlushThreshold = 64 * 1024;
+
+	static const TCHAR* LexToString(EExampleInclusionDecisionSource Source)
+	{
+		switch (Source)
+		{
+		case EExampleInclusionDecisionSource::VersionMatrix: return TEXT("version_matrix");
+		default: return TEXT("evaluated");
+		}
+	}
+
+	static const TCHAR* GetReason(const FExampleAssetInclusionDecision& Decision, const FExampleVersion& ReleaseVersion)
+	{
+		if (!Decision.bHasVersionRange)
+		{
+			return TEXT("no_version_range");
+		}
+		if (Decision.bShouldInclude)
+		{
+			return TEXT("in_range");
+		}
+		return ReleaseVersion.GetPackedKey() < Decision.VersionRange.IntroVersion.GetPackedKey() ? TEXT("before_intro") : TEXT("at_or_after_sunset");
+	}
+
+	static void AppendJsonString(FString& Out, const FString& Value)
+	{
+		Out += TEXT('"');
+		for (const TCHAR Char : Value)
+		{
+			if (Char == TEXT('"') || Char == TEXT('\\'))
+			{
+				Out += TEXT('\\');
+			}
+			Out += Char;
+		}
+		Out += TEXT('"');
+	}
+}
+
+/** Writes chunks of journal text to disk on its own thread */
+class FExampleInclusionJournalWriter : public FRunnable
+{
+public:
+	explicit FExampleInclusionJournalWriter(const FString& Filename)
+		: Archive(IFileManager::Get().CreateFileWriter(*Filename))
+		, WorkEvent(FPlatformProcess::GetSynchEventFromPool())
+	{
+		if (!Archive)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to open inclusion journal '%s' for writing."), *Filename);
+		}
+		Thread.Reset(FRunnableThread::Create(this, TEXT("ExampleInclusionJournalWriter"), 0, TPri_BelowNormal));
+	}
+
+	virtual ~FExampleInclusionJournalWriter() override
+	{
+		// Stop() lets Run() drain the queue, joining the thread makes sure everything reached the archive
+		Stop();
+		Thread.Reset();
+		if (Archive)
+		{
+			Archive->Close();
+		}
+		FPlatformProcess::ReturnSynchEventToPool(WorkEvent);
+	}
+
+	void Enqueue(const FString& Text)
+	{
+		FTCHARToUTF8 Utf8(*Text);
+		Pending.Enqueue(TArray<uint8>((const uint8*)Utf8.Get(), Utf8.Length()));
+		WorkEvent->Trigger();
+	}
+
+	virtual uint32 Run() override
+	{
+		while (!bStopping.load(std::memory_order_acquire))
+		{
+			WorkEvent->Wait();
+			WritePending();
+		}
+		WritePending();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping.store(true, std::memory_order_release);
+		WorkEvent->Trigger();
+	}
+
+private:
+	void WritePending()
+	{
+		TArray<uint8> Chunk;
+		while (Pending.Dequeue(Chunk))
+		{
+			if (Archive)
+			{
+				Archive->Serialize(Chunk.GetData(), Chunk.Num());
+			}
+		}
+	}
+
+	TUniquePtr<FArchive> Archive;
+	TQueue<TArray<uint8>, EQueueMode::Spsc> Pending;
+	FEvent* WorkEvent;
+	std::atomic<bool> bStopping = false;
+	TUniquePtr<FRunnableThread> Thread;
+};
+
+FExampleInclusionJournal::FExampleInclusionJournal(EExampleInclusionJournalVerbosity InVerbosity, const FExampleVersion& InReleaseVersion, const FString& Filename)
+	: Verbosity(InVerbosity)
+	, ReleaseVersion(InReleaseVersion)
+{
+	if (Verbosity != EExampleInclusionJournalVerbosity::Off)
+	{
+		Writer = MakeUnique<FExampleInclusionJournalWriter>(Filename);
+		PendingLines = FString::Printf(TEXT("{\"release_version\":\"%s\"}\n"), *ReleaseVersion.ToString());
+	}
+}
+
+FExampleInclusionJournal::~FExampleInclusionJournal()
+{
+	Finish();
+}
+
+void FExampleInclusionJournal::Record(const FPrimaryAssetId& AssetId, const FExampleAssetInclusionDecision& Decision)
+{
+	using namespace ExampleInclusionJournal;
+
+	FTypeCounts& Counts = TypeCounts.FindOrAdd(AssetId.PrimaryAssetType);
+	++(!Decision.bHasVersionRange ? Counts.NumMissingVersionRange : Decision.bShouldInclude ? Counts.NumIncluded : Counts.NumExcluded);
+
+	if (Verbosity != EExampleInclusionJournalVerbosity::Decisions)
+	{
+		return;
+	}
+
+	PendingLines += TEXT("{\"asset\":");
+	AppendJsonString(PendingLines, AssetId.ToString());
+	if (Decision.bHasVersionRange)
+	{
+		const FExampleVersionRange& Range = Decision.VersionRange;
+		PendingLines += FString::Printf(TEXT(",\"intro\":\"%s\",\"sunset\":"), *Range.IntroVersion.ToString());
+		PendingLines += Range.bHasSunsetVersion ? FString::Printf(TEXT("\"%s\""), *Range.SunsetVersion.ToString()) : FString(TEXT("null"));
+	}
+	PendingLines += FString::Printf(TEXT(",\"decision\":\"%s\",\"reason\":\"%s\",\"source\":\"%s\"}\n"),
+		!Decision.bHasVersionRange ? TEXT("error") : Decision.bShouldInclude ? TEXT("include") : TEXT("exclude"),
+		GetReason(Decision, ReleaseVersion), LexToString(Decision.Source));
+
+	if (PendingLines.Len() >= FlushThreshold)
+	{
+		FlushPendingLines();
+	}
+}
+
+void FExampleInclusionJournal::Finish()
+{
+	if (bFinished)
+	{
+		return;
+	}
+	bFinished = true;
+
+	TypeCounts.KeySort([](const FPrimaryAssetType& A, const FPrimaryAssetType& B) { return A.GetName().LexicalLess(B.GetName()); });
+	FString SummaryLine = TEXT("{\"summary\":{");
+	bool bFirst = true;
+	for (const TPair<FPrimaryAssetType, FTypeCounts>& Pair : TypeCounts)
+	{
+		const FTypeCounts& Counts = Pair.Value;
+		UE_LOG(LogTemp, Display, TEXT("  Primary asset type '%s': %d included, %d excluded, %d without version range"),
+			*Pair.Key.ToString(), Counts.NumIncluded, Counts.NumExcluded, Counts.NumMissingVersionRange);
+		SummaryLine += FString::Printf(TEXT("%s\"%s\":{\"included\":%d,\"excluded\":%d,\"missing_version_range\":%d}"),
+			bFirst ? TEXT("") : TEXT(","), *Pair.Key.ToString(), Counts.NumIncluded, Counts.NumExcluded, Counts.NumMissingVersionRange);
+		bFirst = false;
+	}
+	SummaryLine += TEXT("}}\n");
+
+	if (Writer)
+	{
+		PendingLines += SummaryLine;
+		FlushPendingLines();
+		// Joins the writer thread once everything is on disk
+		Writer.Reset();
+	}
+}
+
+void FExampleInclusionJournal::FlushPendingLines()
+{
+	if (Writer && !PendingLines.IsEmpty())
+	{
+		Writer->Enqueue(PendingLines);
+	}
+	PendingLines.Reset();
+}
+
+EExampleInclusionJournalVerbosity FExampleInclusionJournal::GetConfiguredVerbosity()
+{
+	FString Value;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("ExampleInclusionJournal="), Value))
+	{
+		GConfig->GetString(TEXT("MyGame"), TEXT("InclusionJournalVerbosity"), Value, GGameIni);
+	}
+
+	if (Value.Equals(TEXT("Decisions"), ESearchCase::IgnoreCase))
+	{
+		return EExampleInclusionJournalVerbosity::Decisions;
+	}
+	if (Value.Equals(TEXT("Off"), ESearchCase::IgnoreCase))
+	{
+		return EExampleInclusionJournalVerbosity::Off;
+	}
+	return EExampleInclusionJournalVerbosity::Summary;
+}
+
+FString FExampleInclusionJournal::GetDefaultFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ExampleInclusion") / TEXT("InclusionJournal.jsonl");
+}
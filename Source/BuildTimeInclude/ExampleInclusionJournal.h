@@ -0,0 +1,61 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/PrimaryAssetId.h"
+#include "ExampleVersion.h"
+
+struct FExampleAssetInclusionDecision;
+class FExampleInclusionJournalWriter;
+
+enum class EExampleInclusionJournalVerbosity : uint8
+{
+	// No journal file, only the summary in the cook log
+	Off,
+	// Journal file with the per-type summary only
+	Summary,
+	// Journal file with one line per asset followed by the summary
+	Decisions,
+};
+
+/**
+ * Structured record of the inclusion decisions made by the label pass, replacing per-asset log lines. Each decision is
+ * written as one JSON line with the asset id, decoded range, decision and reason. Lines are buffered and handed to a
+ * background thread for writing, so the label pass never waits on file I/O. The journal ends with aggregate counts per
+ * primary asset type, which are also logged.
+ *
+ * Verbosity comes from -ExampleInclusionJournal=Off|Summary|Decisions or [MyGame] InclusionJournalVerbosity.
+ */
+class BUILDTIMEINCLUDE_API FExampleInclusionJournal
+{
+public:
+	FExampleInclusionJournal(EExampleInclusionJournalVerbosity InVerbosity, const FExampleVersion& InReleaseVersion, const FString& Filename = GetDefaultFilename());
+	~FExampleInclusionJournal();
+
+	// Record the decision for one asset, including assets without version range
+	void Record(const FPrimaryAssetId& AssetId, const FExampleAssetInclusionDecision& Decision);
+
+	// Write and log the per-type summary and flush everything to disk. Called by the destructor if not called before.
+	void Finish();
+
+	static EExampleInclusionJournalVerbosity GetConfiguredVerbosity();
+	static FString GetDefaultFilename();
+
+private:
+	struct FTypeCounts
+	{
+		int32 NumIncluded = 0;
+		int32 NumExcluded = 0;
+		int32 NumMissingVersionRange = 0;
+	};
+
+	void FlushPendingLines();
+
+	EExampleInclusionJournalVerbosity Verbosity;
+	FExampleVersion ReleaseVersion;
+	TMap<FPrimaryAssetType, FTypeCounts> TypeCounts;
+	FString PendingLines;
+	TUniquePtr<FExampleInclusionJournalWriter> Writer;
+	bool bFinished = false;
+};
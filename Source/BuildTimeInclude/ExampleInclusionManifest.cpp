@@ -0,0 +1,219 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleInclusionManifest.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace ExampleInclusionManifest
+{
+	static constexpr uint32 FileMagic = 0x4D495845; // 'EXIM'
+	static constexpr uint32 FileVersion = 2;
+
+	// Plain int32 length plus UTF-8 bytes, unlike FString serialization, so C# can read it with BinaryReader
+	static void SerializeUtf8String(FArchive& Ar, FString& Value)
+	{
+		if (Ar.IsLoading())
+		{
+			int32 Length = 0;
+			Ar << Length;
+			if (Length < 0 || Length > Ar.TotalSize() - Ar.Tell())
+			{
+				Ar.SetError();
+				return;
+			}
+			TArray<UTF8CHAR> Utf8;
+			Utf8.SetNumUninitialized(Length);
+			Ar.Serialize(Utf8.GetData(), Length);
+			Value = FString(Length, Utf8.GetData());
+		}
+		else
+		{
+			FTCHARToUTF8 Utf8(*Value);
+			int32 Length = Utf8.Length();
+			Ar << Length;
+			Ar.Serialize((void*)Utf8.Get(), Length);
+		}
+	}
+
+	// bool serializes as 4 bytes in FArchive, write ranges field by field with a single byte flag
+	static void SerializeVersionRange(FArchive& Ar, FExampleVersionRange& Range)
+	{
+		uint8 bHasSunsetVersion = Range.bHasSunsetVersion ? 1 : 0;
+		Ar << Range.IntroVersion << bHasSunsetVersion << Range.SunsetVersion;
+		Range.bHasSunsetVersion = bHasSunsetVersion != 0;
+	}
+
+	static bool SerializeHeader(FArchive& Ar, FExampleVersion& ReleaseVersion)
+	{
+		uint32 Magic = FileMagic;
+		uint32 Version = FileVersion;
+		Ar << Magic << Version;
+		if (Magic != FileMagic || Version != FileVersion)
+		{
+			Ar.SetError();
+			return false;
+		}
+		Ar << ReleaseVersion;
+		return !Ar.IsError();
+	}
+}
+
+const FExampleInclusionManifestPlugin* FExampleInclusionManifest::FindPlugin(FStringView PluginName) const
+{
+	const int32* Index = PluginIndices.Find(FString(PluginName));
+	return Index ? &Plugins[*Index] : nullptr;
+}
+
+bool FExampleInclusionManifest::IsPluginIncluded(FStringView PluginName) const
+{
+	const FExampleInclusionManifestPlugin* Plugin = FindPlugin(PluginName);
+	return Plugin && Plugin->bIncluded;
+}
+
+bool FExampleInclusionManifest::IsAssetIncluded(const FPrimaryAssetId& PrimaryAssetId) const
+{
+	FExampleVersionRange VersionRange;
+	return Assets.TryGetVersionRange(PrimaryAssetId, VersionRange);
+}
+
+bool FExampleInclusionManifest::SaveToFile(const FString& Filename) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	const_cast<FExampleInclusionManifest*>(this)->Serialize(Writer);
+	if (!FFileHelper::SaveArrayToFile(Bytes, *Filename))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write inclusion manifest '%s'."), *Filename);
+		return false;
+	}
+	return true;
+}
+
+bool FExampleInclusionManifest::LoadFromFile(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename, FILEREAD_Silent))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Inclusion manifest '%s' not found."), *Filename);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+	Serialize(Reader);
+	if (Reader.IsError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Inclusion manifest '%s' is corrupt or was written by an incompatible version."), *Filename);
+		*this = FExampleInclusionManifest();
+		return false;
+	}
+	return true;
+}
+
+void FExampleInclusionManifest::Serialize(FArchive& Ar)
+{
+	using namespace ExampleInclusionManifest;
+	if (!SerializeHeader(Ar, ReleaseVersion))
+	{
+		return;
+	}
+
+	int32 NumPlugins = Plugins.Num();
+	Ar << NumPlugins;
+	if (Ar.IsLoading())
+	{
+		if (NumPlugins < 0 || NumPlugins > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return;
+		}
+		Plugins.SetNum(NumPlugins);
+	}
+	for (FExampleInclusionManifestPlugin& Plugin : Plugins)
+	{
+		SerializeUtf8String(Ar, Plugin.Name);
+		Ar << Plugin.DescriptorHash;
+		SerializeVersionRange(Ar, Plugin.VersionRange);
+		uint8 bIncluded = Plugin.bIncluded ? 1 : 0;
+		uint8 bShipped = Plugin.bShipped ? 1 : 0;
+		Ar << bIncluded << bShipped;
+		Plugin.bIncluded = bIncluded != 0;
+		Plugin.bShipped = bShipped != 0;
+		if (Ar.IsError())
+		{
+			return;
+		}
+	}
+
+	// The asset section is length prefixed, so UBT can carry it over without understanding it
+	if (Ar.IsLoading())
+	{
+		int64 AssetSectionSize = 0;
+		Ar << AssetSectionSize;
+		if (AssetSectionSize < 0 || AssetSectionSize > Ar.TotalSize() - Ar.Tell())
+		{
+			Ar.SetError();
+			return;
+		}
+		Assets = FExampleVersionRangeTable();
+		if (AssetSectionSize > 0)
+		{
+			const int64 AssetSectionEnd = Ar.Tell() + AssetSectionSize;
+			Assets.Serialize(Ar);
+			if (Ar.Tell() != AssetSectionEnd)
+			{
+				Ar.SetError();
+			}
+		}
+		RebuildPluginIndices();
+	}
+	else
+	{
+		TArray<uint8> AssetSection;
+		if (Assets.Num() > 0)
+		{
+			FMemoryWriter AssetWriter(AssetSection);
+			Assets.Serialize(AssetWriter);
+		}
+		int64 AssetSectionSize = AssetSection.Num();
+		Ar << AssetSectionSize;
+		Ar.Serialize(AssetSection.GetData(), AssetSection.Num());
+	}
+}
+
+void FExampleInclusionManifest::RebuildPluginIndices()
+{
+	PluginIndices.Reset();
+	for (int32 Index = 0; Index < Plugins.Num(); ++Index)
+	{
+		PluginIndices.Add(Plugins[Index].Name, Index);
+	}
+}
+
+bool FExampleInclusionManifest::TryReadReleaseVersion(const FString& Filename, FExampleVersion& OutReleaseVersion)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename, FILEREAD_Silent));
+	if (!Reader)
+	{
+		return false;
+	}
+
+	FExampleVersion ReleaseVersion;
+	if (!ExampleInclusionManifest::SerializeHeader(*Reader, ReleaseVersion))
+	{
+		return false;
+	}
+	OutReleaseVersion = ReleaseVersion;
+	return true;
+}
+
+FString FExampleInclusionManifest::GetDefaultFilename()
+{
+	if (FPlatformProperties::RequiresCookedData())
+	{
+		return FPaths::ProjectDir() / TEXT("ExampleInclusion") / TEXT("InclusionManifest.bin");
+	}
+	return FPaths::ProjectSavedDir() / TEXT("ExampleInclusion") / TEXT("InclusionManifest.bin");
+}
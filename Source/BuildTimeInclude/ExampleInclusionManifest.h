@@ -0,0 +1,67 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExampleVersionRange.h"
+#include "ExampleVersionRangeTable.h"
+
+// Build-time decision for one GameFeature plugin, recorded by BuildTimeInclude.Target.cs
+struct FExampleInclusionManifestPlugin
+{
+	FString Name;
+	// FNV-1a 64 of the .uplugin file's bytes. UBT only re-parses descriptors whose hash changed.
+	uint64 DescriptorHash = 0;
+	FExampleVersionRange VersionRange;
+	// Included at the build's release version
+	bool bIncluded = false;
+	// Enabled in the build: included at the release version or at any version up to [MyGame] ExampleLiveOpsMaxVersion.
+	// Shipped plugins that aren't included start out registered instead of active, see UExampleGameFeaturePolicy.
+	bool bShipped = false;
+};
+
+/**
+ * Every inclusion decision of a build in one binary file, keyed by the release version it was made for:
+ * - GameFeature plugin decisions, written by UBT (BuildTimeIncludeTarget.ConfigureGameFeaturePlugins)
+ * - Version ranges of all included primary assets, written by the cooker (UExampleAssetManager::ApplyPrimaryAssetLabels)
+ *
+ * It is written to Saved and staged with the build, so the game knows its release version and can answer inclusion
+ * questions without parsing descriptors or reading asset tags. UBT and the cooker each rewrite only their own section
+ * and keep the other one as long as the release version matches.
+ *
+ * Little-endian layout, shared with the C# reader and writer in BuildTimeInclude.Target.cs:
+ *   uint32 Magic 'EXIM', uint32 FormatVersion, int32 ReleaseMajor, int32 ReleaseMinor
+ *   int32 NumPlugins, per plugin:
+ *     int32 NameLength, UTF-8 Name bytes, uint64 DescriptorHash, FExampleVersion Intro, uint8 bHasSunset, FExampleVersion Sunset, uint8 bIncluded, uint8 bShipped
+ *   int64 AssetSectionSize, then that many bytes of FExampleVersionRangeTable::Serialize output (opaque to C#)
+ */
+class BUILDTIMEINCLUDE_API FExampleInclusionManifest
+{
+public:
+	FExampleVersion ReleaseVersion;
+	TArray<FExampleInclusionManifestPlugin> Plugins;
+	FExampleVersionRangeTable Assets;
+
+	// Decision for a plugin by name, nullptr if UBT didn't record one. Case insensitive.
+	const FExampleInclusionManifestPlugin* FindPlugin(FStringView PluginName) const;
+	bool IsPluginIncluded(FStringView PluginName) const;
+	// Whether the asset shipped with the build, O(1)
+	bool IsAssetIncluded(const FPrimaryAssetId& PrimaryAssetId) const;
+
+	bool SaveToFile(const FString& Filename) const;
+	bool LoadFromFile(const FString& Filename);
+	void Serialize(FArchive& Ar);
+
+	// Only reads the header. Used to resolve the release version of a packaged game.
+	static bool TryReadReleaseVersion(const FString& Filename, FExampleVersion& OutReleaseVersion);
+
+	// Saved/ExampleInclusion while building and cooking, where UBT and the cooker write it. Cooked builds read the copy
+	// BuildTimeInclude.Build.cs stages to ExampleInclusion/ under the project directory.
+	static FString GetDefaultFilename();
+
+private:
+	void RebuildPluginIndices();
+
+	// FString keys compare case insensitively
+	TMap<FString, int32> PluginIndices;
+};
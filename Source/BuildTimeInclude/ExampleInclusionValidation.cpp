@@ -0,0 +1,154 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleInclusionValidation.h"
+#include "ExampleAssetManager.h"
+#include "Algo/Reverse.h"
+#include "Async/ParallelFor.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/World.h"
+#include "Misc/PackageName.h"
+
+namespace ExampleInclusionValidation
+{
+	// References from these packages to excluded actor classes are expected, PostLoad marks the instances transient
+	static bool IsExemptReferencer(const IAssetRegistry& AssetRegistry, FName PackageName)
+	{
+		TStringBuilder<256> PackageNameString;
+		PackageName.ToString(PackageNameString);
+		if (FStringView(PackageNameString).Contains(TEXT("/__ExternalActors__/")))
+		{
+			return true;
+		}
+
+		TArray<FAssetData> PackageAssets;
+		AssetRegistry.GetAssetsByPackageName(PackageName, PackageAssets, true);
+		return PackageAssets.ContainsByPredicate([](const FAssetData& AssetData) { return AssetData.AssetClassPath == UWorld::StaticClass()->GetClassPathName(); });
+	}
+}
+
+FString FExampleInclusionViolation::ToString() const
+{
+	return FString::JoinBy(ReferenceChain, TEXT(" -> "), [](FName PackageName) { return PackageName.ToString(); });
+}
+
+void FExampleInclusionValidator::FindViolations(TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions,
+	TConstArrayView<FName> UnversionedPackages, TArray<FExampleInclusionViolation>& OutViolations)
+{
+	using namespace ExampleInclusionValidation;
+	check(Assets.Num() == Decisions.Num());
+	OutViolations.Reset();
+	const IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+	// Node ids are handed out in order of first sight, Parents, Visited and Excluded are indexed by them
+	TArray<FName> Nodes;
+	TMap<FName, int32> NodeIds;
+	TArray<int32> Parents;
+	TBitArray<> Visited;
+	TBitArray<> Excluded;
+	TArray<int32> Frontier;
+
+	auto FindOrAddNode = [&](FName PackageName)
+	{
+		if (const int32* ExistingId = NodeIds.Find(PackageName))
+		{
+			return *ExistingId;
+		}
+		const int32 NodeId = Nodes.Add(PackageName);
+		NodeIds.Add(PackageName, NodeId);
+		Parents.Add(INDEX_NONE);
+		Visited.Add(false);
+		Excluded.Add(false);
+		return NodeId;
+	};
+	auto AddRoot = [&](FName PackageName)
+	{
+		const int32 NodeId = FindOrAddNode(PackageName);
+		if (!Excluded[NodeId] && !Visited[NodeId])
+		{
+			Visited[NodeId] = true;
+			Frontier.Add(NodeId);
+		}
+	};
+
+	for (int32 Index = 0; Index < Assets.Num(); ++Index)
+	{
+		if (Decisions[Index].bHasVersionRange && !Decisions[Index].bShouldInclude)
+		{
+			Excluded[FindOrAddNode(Assets[Index].PackageName)] = true;
+		}
+	}
+	for (int32 Index = 0; Index < Assets.Num(); ++Index)
+	{
+		if (Decisions[Index].bShouldInclude)
+		{
+			AddRoot(Assets[Index].PackageName);
+		}
+	}
+	for (const FName PackageName : UnversionedPackages)
+	{
+		AddRoot(PackageName);
+	}
+
+	TArray<TArray<FName>> FrontierDependencies;
+	TArray<int32> NextFrontier;
+	while (Frontier.Num() > 0)
+	{
+		// Registry queries are the expensive part and are thread-safe, run them for the whole level at once
+		FrontierDependencies.Reset();
+		FrontierDependencies.SetNum(Frontier.Num());
+		ParallelFor(Frontier.Num(), [&](int32 FrontierIndex)
+		{
+			AssetRegistry.GetDependencies(Nodes[Frontier[FrontierIndex]], FrontierDependencies[FrontierIndex], UE::AssetRegistry::EDependencyCategory::Package,
+				UE::AssetRegistry::FDependencyQuery(UE::AssetRegistry::EDependencyQuery::Game));
+		});
+
+		// Merge serially in frontier order, which keeps the reported chains deterministic
+		NextFrontier.Reset();
+		for (int32 FrontierIndex = 0; FrontierIndex < Frontier.Num(); ++FrontierIndex)
+		{
+			const int32 NodeId = Frontier[FrontierIndex];
+			for (const FName Dependency : FrontierDependencies[FrontierIndex])
+			{
+				// Native script packages have no content dependencies worth following and never get a node
+				if (FPackageName::IsScriptPackage(FNameBuilder(Dependency).ToView()))
+				{
+					continue;
+				}
+
+				const int32 DependencyId = FindOrAddNode(Dependency);
+				if (Excluded[DependencyId])
+				{
+					if (!IsExemptReferencer(AssetRegistry, Nodes[NodeId]))
+					{
+						FExampleInclusionViolation& Violation = OutViolations.AddDefaulted_GetRef();
+						Violation.ReferenceChain.Add(Dependency);
+						for (int32 ChainNode = NodeId; ChainNode != INDEX_NONE; ChainNode = Parents[ChainNode])
+						{
+							Violation.ReferenceChain.Add(Nodes[ChainNode]);
+						}
+						Algo::Reverse(Violation.ReferenceChain);
+					}
+					continue;
+				}
+
+				if (!Visited[DependencyId])
+				{
+					Visited[DependencyId] = true;
+					Parents[DependencyId] = NodeId;
+					NextFrontier.Add(DependencyId);
+				}
+			}
+		}
+		Swap(Frontier, NextFrontier);
+	}
+}
+
+bool FExampleInclusionValidator::IsEnabledForCook()
+{
+	bool bValidate = false;
+	if (!FParse::Bool(FCommandLine::Get(), TEXT("ExampleValidateInclusion="), bValidate))
+	{
+		GConfig->GetBool(TEXT("MyGame"), TEXT("bValidateInclusionClosure"), bValidate, GGameIni);
+	}
+	return bValidate;
+}
@@ -0,0 +1,43 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+
+struct FExampleAssetInclusionDecision;
+
+// A reference from content that will be cooked to content that was version excluded
+struct FExampleInclusionViolation
+{
+	// Package chain from an included primary asset down to the excluded package, both ends included
+	TArray<FName> ReferenceChain;
+
+	FName GetReferencer() const { return ReferenceChain.Num() >= 2 ? ReferenceChain.Last(1) : NAME_None; }
+	FName GetExcludedPackage() const { return ReferenceChain.Num() ? ReferenceChain.Last() : NAME_None; }
+	FString ToString() const;
+};
+
+/**
+ * Pre-cook check that no included content references version-excluded content. Walks the asset registry's game
+ * dependency graph from the packages of all included versioned primary assets and all cooked unversioned ones
+ * (GameFeatureData, PrimaryAssetLabel, maps) and reports every edge into a package of an excluded primary asset, with
+ * the full reference chain. This catches in seconds what AExampleActor::PreSave would otherwise only catch when the
+ * package gets saved, hours into the cook.
+ *
+ * The walk is breadth-first, one level at a time: dependencies of all packages in a level are queried in parallel,
+ * then merged serially. Every package reached gets a dense node id, visited and excluded are bit arrays over those ids.
+ * References from maps and their external actor packages are not reported, since AExampleActor::PostLoad strips
+ * version excluded actor instances from them.
+ */
+class BUILDTIMEINCLUDE_API FExampleInclusionValidator
+{
+public:
+	// Assets and Decisions must match by index, as produced by UExampleAssetManager::EvaluateVersionedAssets.
+	// UnversionedPackages are additional roots, see UExampleAssetManager::GatherUnversionedAssetPackages.
+	static void FindViolations(TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions,
+		TConstArrayView<FName> UnversionedPackages, TArray<FExampleInclusionViolation>& OutViolations);
+
+	// Whether to validate at the end of ApplyPrimaryAssetLabels: -ExampleValidateInclusion=True|False or [MyGame] bValidateInclusionClosure
+	static bool IsEnabledForCook();
+};
@@ -0,0 +1,60 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleInclusionValidationCommandlet.h"
+#include "ExampleAssetManager.h"
+#include "ExampleInclusionValidation.h"
+#include "ExampleVersionRangeCache.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+UExampleInclusionValidationCommandlet::UExampleInclusionValidationCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UExampleInclusionValidationCommandlet::Main(const FString& Params)
+{
+	UExampleAssetManager* AssetManager = Cast<UExampleAssetManager>(UAssetManager::GetIfInitialized());
+	if (!AssetManager)
+	{
+		UE_LOG(LogTemp, Error, TEXT("The project's asset manager must be UExampleAssetManager."));
+		return 1;
+	}
+
+	FExampleVersion ReleaseVersion = UExampleAssetManager::GetReleaseVersion();
+	FString VersionString;
+	if (FParse::Value(*Params, TEXT("Version="), VersionString) && !UExampleAssetManager::TryParseReleaseVersion(VersionString, ReleaseVersion))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Invalid -Version=%s, expected X.Y."), *VersionString);
+		return 1;
+	}
+
+	// Make sure the primary asset directory reflects everything on disk
+	IAssetRegistry::GetChecked().SearchAllAssets(true);
+#if WITH_EDITOR
+	AssetManager->RefreshPrimaryAssetDirectory(true);
+#endif
+
+	TArray<FAssetData> VersionedAssets;
+	AssetManager->GatherVersionedAssets(VersionedAssets);
+	FExampleVersionRangeDecodeCache DecodeCache;
+	TArray<FExampleAssetInclusionDecision> Decisions;
+	UExampleAssetManager::EvaluateVersionedAssets(VersionedAssets, ReleaseVersion, DecodeCache, true, Decisions);
+
+	TArray<FName> UnversionedPackages;
+	AssetManager->GatherUnversionedAssetPackages(UnversionedPackages);
+
+	const double StartTime = FPlatformTime::Seconds();
+	TArray<FExampleInclusionViolation> Violations;
+	FExampleInclusionValidator::FindViolations(VersionedAssets, Decisions, UnversionedPackages, Violations);
+	for (const FExampleInclusionViolation& Violation : Violations)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Included package '%s' references version excluded package '%s': %s"),
+			*Violation.GetReferencer().ToString(), *Violation.GetExcludedPackage().ToString(), *Violation.ToString());
+	}
+	UE_LOG(LogTemp, Display, TEXT("Validated %d versioned and %d unversioned assets at %s in %.2f s, %d references to excluded content"),
+		VersionedAssets.Num(), UnversionedPackages.Num(), *ReleaseVersion.ToString(), FPlatformTime::Seconds() - StartTime, Violations.Num());
+	return Violations.Num() > 0 ? 1 : 0;
+}
@@ -0,0 +1,26 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ExampleInclusionValidationCommandlet.generated.h"
+
+/**
+ * Checks that no content included at a release version references version excluded content, without running a cook.
+ * Meant as a CI gate in front of the cook:
+ *
+ *   UnrealEditor-Cmd BuildTimeInclude.uproject -run=ExampleInclusionValidation -Version=4.0
+ *
+ * -Version defaults to the configured release version. Returns non-zero if any violation was found.
+ */
+UCLASS()
+class BUILDTIMEINCLUDE_API UExampleInclusionValidationCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UExampleInclusionValidationCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,283 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleReceiverRegistrationSubsystem.h"
+#include "ExampleActor.h"
+#include "Components/GameFrameworkComponentManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFeatureAction_AddComponents.h"
+#include "GameFeatureData.h"
+#include "GameFeaturesSubsystem.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+static FAutoConsoleCommandWithWorldAndArgs ExampleReceiverStressCommand(
+	TEXT("Example.ReceiverStress"),
+	TEXT("Spawn actors and log frame times until they're all registered as component receivers. Usage: Example.ReceiverStress [Count=10000] [Batched|Immediate] [ActorClassPath]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UExampleReceiverRegistrationSubsystem* Subsystem = UWorld::GetSubsystem<UExampleReceiverRegistrationSubsystem>(World);
+		if (!Subsystem)
+		{
+			UE_LOG(LogTemp, Error, TEXT("Example.ReceiverStress needs a game world"));
+			return;
+		}
+
+		const int32 Count = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10000;
+		const bool bBatched = Args.Num() <= 1 || !Args[1].Equals(TEXT("Immediate"), ESearchCase::IgnoreCase);
+		UClass* ActorClass = AExampleActor::StaticClass();
+		if (Args.Num() > 2)
+		{
+			ActorClass = LoadClass<AActor>(nullptr, *Args[2]);
+			if (!ActorClass)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Example.ReceiverStress could not load actor class '%s'"), *Args[2]);
+				return;
+			}
+		}
+		Subsystem->RunStressTest(Count, bBatched, ActorClass);
+	}));
+
+void UExampleReceiverRegistrationSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (!FParse::Bool(FCommandLine::Get(), TEXT("ExampleBatchReceivers="), bBatchingEnabled))
+	{
+		GConfig->GetBool(TEXT("MyGame"), TEXT("bBatchReceiverRegistration"), bBatchingEnabled, GGameIni);
+	}
+	float BudgetMs = 2.f;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("ExampleReceiverBudgetMs="), BudgetMs))
+	{
+		GConfig->GetFloat(TEXT("MyGame"), TEXT("ReceiverRegistrationBudgetMs"), BudgetMs, GGameIni);
+	}
+	BudgetSeconds = FMath::Max(BudgetMs, 0.f) / 1000.0;
+
+	UGameFeaturesSubsystem& GameFeatures = UGameFeaturesSubsystem::Get();
+	TArray<const UGameFeatureData*> ActiveGameFeatures;
+	GameFeatures.GetGameFeatureDataForActivePlugins(ActiveGameFeatures);
+	for (const UGameFeatureData* GameFeatureData : ActiveGameFeatures)
+	{
+		OnGameFeatureActivating(GameFeatureData, FString());
+	}
+	GameFeatures.AddObserver(this);
+}
+
+void UExampleReceiverRegistrationSubsystem::Deinitialize()
+{
+	UGameFeaturesSubsystem::Get().RemoveObserver(this);
+	PendingReceivers.Reset();
+	PendingReceiversHead = 0;
+	StressTest.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UExampleReceiverRegistrationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UExampleReceiverRegistrationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UExampleReceiverRegistrationSubsystem, STATGROUP_Tickables);
+}
+
+UGameFrameworkComponentManager* UExampleReceiverRegistrationSubsystem::GetComponentManager() const
+{
+	return UGameInstance::GetSubsystem<UGameFrameworkComponentManager>(GetWorld()->GetGameInstance());
+}
+
+void UExampleReceiverRegistrationSubsystem::OnGameFeatureActivating(const UGameFeatureData* GameFeatureData, const FString& PluginURL)
+{
+	TArray<FSoftObjectPath>& TargetClasses = ActiveComponentTargets.FindOrAdd(GameFeatureData);
+	TargetClasses.Reset();
+	for (const UGameFeatureAction* Action : GameFeatureData->GetActions())
+	{
+		if (const UGameFeatureAction_AddComponents* AddComponents = Cast<UGameFeatureAction_AddComponents>(Action))
+		{
+			for (const FGameFeatureComponentEntry& Entry : AddComponents->ComponentList)
+			{
+				TargetClasses.AddUnique(Entry.ActorClass.ToSoftObjectPath());
+			}
+		}
+	}
+	RebuildComponentTargetClasses();
+}
+
+void UExampleReceiverRegistrationSubsystem::OnGameFeatureDeactivating(const UGameFeatureData* GameFeatureData, FGameFeatureDeactivatingContext& Context, const FString& PluginURL)
+{
+	ActiveComponentTargets.Remove(GameFeatureData);
+	RebuildComponentTargetClasses();
+}
+
+void UExampleReceiverRegistrationSubsystem::RebuildComponentTargetClasses()
+{
+	ComponentTargetClasses.Reset();
+	for (const TPair<TObjectKey<UGameFeatureData>, TArray<FSoftObjectPath>>& Pair : ActiveComponentTargets)
+	{
+		ComponentTargetClasses.Append(Pair.Value);
+	}
+	ClassReceivesComponents.Reset();
+}
+
+bool UExampleReceiverRegistrationSubsystem::DoesClassReceiveComponents(const UClass* ActorClass)
+{
+	if (const bool* bCached = ClassReceivesComponents.Find(ActorClass))
+	{
+		return *bCached;
+	}
+
+	// Same walk up the class hierarchy as the component manager does for every receiver, done once per class
+	bool bReceivesComponents = false;
+	for (const UClass* Class = ActorClass; Class && !bReceivesComponents; Class = Class->GetSuperClass())
+	{
+		bReceivesComponents = ComponentTargetClasses.Contains(FSoftObjectPath(Class));
+	}
+	ClassReceivesComponents.Add(ActorClass, bReceivesComponents);
+	return bReceivesComponents;
+}
+
+void UExampleReceiverRegistrationSubsystem::AddReceiver(AActor* Receiver)
+{
+	// Components requested after this are still added to the actor, the component manager applies new requests to
+	// all matching actors in the world. Receivers of other classes only need registering for extension events.
+	if (!bBatchingEnabled || !DoesClassReceiveComponents(Receiver->GetClass()))
+	{
+		if (UGameFrameworkComponentManager* ComponentManager = GetComponentManager())
+		{
+			ComponentManager->AddReceiver(Receiver);
+		}
+		return;
+	}
+
+	PendingReceivers.Add(Receiver);
+}
+
+void UExampleReceiverRegistrationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (GetNumPendingReceivers() > 0)
+	{
+		RegisterPendingReceivers(BudgetSeconds);
+	}
+
+	if (StressTest.IsSet())
+	{
+		// Delta time of this tick is the duration of the previous frame, which includes the spawn or previous batch
+		StressTest->NumFrames++;
+		StressTest->MaxFrameSeconds = FMath::Max(StressTest->MaxFrameSeconds, FApp::GetDeltaTime());
+		StressTest->TotalFrameSeconds += FApp::GetDeltaTime();
+		if (GetNumPendingReceivers() == 0)
+		{
+			ReportStressTest();
+		}
+	}
+}
+
+void UExampleReceiverRegistrationSubsystem::RegisterPendingReceivers(double InBudgetSeconds)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UExampleReceiverRegistrationSubsystem::RegisterPendingReceivers);
+	UGameFrameworkComponentManager* ComponentManager = GetComponentManager();
+	if (!ComponentManager)
+	{
+		// Without a component manager there's nothing to register with, don't keep the queue around forever
+		UE_LOG(LogTemp, Warning, TEXT("UExampleReceiverRegistrationSubsystem: no component manager, dropping %d pending receivers"), GetNumPendingReceivers());
+		PendingReceivers.Reset();
+		PendingReceiversHead = 0;
+		return;
+	}
+
+	// Always register at least one receiver per frame so a zero budget still makes progress
+	const double StartSeconds = FPlatformTime::Seconds();
+	double NowSeconds = StartSeconds;
+	int32 NumRegistered = 0;
+	while (PendingReceiversHead < PendingReceivers.Num() && (NumRegistered == 0 || NowSeconds - StartSeconds < InBudgetSeconds))
+	{
+		AActor* Receiver = PendingReceivers[PendingReceiversHead++].Get();
+		if (Receiver && Receiver->HasActorBegunPlay() && !Receiver->IsActorBeingDestroyed())
+		{
+			ComponentManager->AddReceiver(Receiver);
+			NowSeconds = FPlatformTime::Seconds();
+			++NumRegistered;
+		}
+	}
+
+	if (StressTest.IsSet())
+	{
+		StressTest->MaxSliceSeconds = FMath::Max(StressTest->MaxSliceSeconds, NowSeconds - StartSeconds);
+	}
+
+	if (PendingReceiversHead == PendingReceivers.Num())
+	{
+		PendingReceivers.Reset();
+		PendingReceiversHead = 0;
+	}
+}
+
+void UExampleReceiverRegistrationSubsystem::RunStressTest(int32 Count, bool bBatched, UClass* ActorClass)
+{
+	if (StressTest.IsSet())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Example.ReceiverStress is already running"));
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	FVector Origin = FVector::ZeroVector;
+	if (APlayerController* PlayerController = World->GetFirstPlayerController())
+	{
+		if (APawn* Pawn = PlayerController->GetPawn())
+		{
+			Origin = Pawn->GetActorLocation();
+		}
+	}
+
+	StressTest.Emplace();
+	StressTest->bBatched = bBatched;
+	StressTest->Actors.Reserve(Count);
+	const bool bWasBatchingEnabled = bBatchingEnabled;
+	bBatchingEnabled = bBatched;
+
+	// AExampleActor logs a warning from BeginPlay, which would dominate the measurement
+	const ELogVerbosity::Type LogTempVerbosity = LogTemp.GetVerbosity();
+	LogTemp.SetVerbosity(ELogVerbosity::Error);
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Count)));
+	StressTest->StartSeconds = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		const FVector Location = Origin + FVector((Index % GridSize) * 100.0, (Index / GridSize) * 100.0, 0.0);
+		StressTest->Actors.Add(World->SpawnActor<AActor>(ActorClass, Location, FRotator::ZeroRotator, SpawnParameters));
+	}
+	StressTest->SpawnSeconds = FPlatformTime::Seconds() - StressTest->StartSeconds;
+
+	LogTemp.SetVerbosity(LogTempVerbosity);
+	bBatchingEnabled = bWasBatchingEnabled;
+
+	UE_LOG(LogTemp, Display, TEXT("Example.ReceiverStress spawned %d '%s' actors in %.2f ms (%s), %d receivers pending"),
+		Count, *ActorClass->GetName(), StressTest->SpawnSeconds * 1000.0, bBatched ? TEXT("batched") : TEXT("immediate"), GetNumPendingReceivers());
+}
+
+void UExampleReceiverRegistrationSubsystem::ReportStressTest()
+{
+	const FStressTest& Test = StressTest.GetValue();
+	UE_LOG(LogTemp, Display, TEXT("Example.ReceiverStress %s: %d actors registered over %d frames in %.2f ms. Spawn %.2f ms, worst frame %.2f ms, average frame %.2f ms, worst registration slice %.2f ms (budget %.2f ms)"),
+		Test.bBatched ? TEXT("batched") : TEXT("immediate"), Test.Actors.Num(), Test.NumFrames, (FPlatformTime::Seconds() - Test.StartSeconds) * 1000.0,
+		Test.SpawnSeconds * 1000.0, Test.MaxFrameSeconds * 1000.0, Test.TotalFrameSeconds * 1000.0 / FMath::Max(Test.NumFrames, 1), Test.MaxSliceSeconds * 1000.0, BudgetSeconds * 1000.0);
+
+	for (const TWeakObjectPtr<AActor>& Actor : Test.Actors)
+	{
+		if (Actor.IsValid())
+		{
+			Actor->Destroy();
+		}
+	}
+	StressTest.Reset();
+}
@@ -0,0 +1,85 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameFeatureStateChangeObserver.h"
+#include "ExampleReceiverRegistrationSubsystem.generated.h"
+
+class AActor;
+class UGameFeatureData;
+class UGameFrameworkComponentManager;
+
+/**
+ * Registers actors as UGameFrameworkComponentManager receivers in time-sliced batches instead of one by one in BeginPlay.
+ *
+ * AddReceiver matches the actor's class hierarchy against all component requests and creates the requested components
+ * right away, so a map or wave that begins play for thousands of AExampleActors at once spikes that frame. Actors whose
+ * class receives components from an active GameFeature (like the hats of ExampleGameFeaturePlugin) are queued and
+ * registered under a per-frame budget. Actors whose class doesn't are registered immediately, that only costs a lookup.
+ * Whether a class receives components is cached per class and reset whenever a GameFeature activates or deactivates.
+ * That cache only decides whether to queue: a queued actor still goes through the component manager's own AddReceiver,
+ * which matches its class hierarchy against the requests again. Batching spreads that work over frames, it doesn't
+ * remove it.
+ *
+ * Configured in DefaultGame.ini [MyGame] with bBatchReceiverRegistration and ReceiverRegistrationBudgetMs.
+ * Run "Example.ReceiverStress [Count] [Batched|Immediate] [ActorClassPath]" in a game world to measure frame times.
+ */
+UCLASS()
+class BUILDTIMEINCLUDE_API UExampleReceiverRegistrationSubsystem : public UTickableWorldSubsystem, public IGameFeatureStateChangeObserver
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	virtual void OnGameFeatureActivating(const UGameFeatureData* GameFeatureData, const FString& PluginURL) override;
+	virtual void OnGameFeatureDeactivating(const UGameFeatureData* GameFeatureData, FGameFeatureDeactivatingContext& Context, const FString& PluginURL) override;
+
+	// Register Receiver with the component manager, now or in one of the next frames
+	void AddReceiver(AActor* Receiver);
+
+	int32 GetNumPendingReceivers() const { return PendingReceivers.Num() - PendingReceiversHead; }
+
+	// Spawn Count actors of ActorClass around the first player and log frame times until all of them are registered
+	void RunStressTest(int32 Count, bool bBatched, UClass* ActorClass);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UGameFrameworkComponentManager* GetComponentManager() const;
+	bool DoesClassReceiveComponents(const UClass* ActorClass);
+	void RebuildComponentTargetClasses();
+	void RegisterPendingReceivers(double BudgetSeconds);
+	void ReportStressTest();
+
+	bool bBatchingEnabled = true;
+	double BudgetSeconds = 0.002;
+
+	// Consumed from PendingReceiversHead so popping a batch doesn't shift the array
+	TArray<TWeakObjectPtr<AActor>> PendingReceivers;
+	int32 PendingReceiversHead = 0;
+
+	// Actor classes targeted by AddComponents actions of active GameFeatures, per GameFeatureData
+	TMap<TObjectKey<UGameFeatureData>, TArray<FSoftObjectPath>> ActiveComponentTargets;
+	TSet<FSoftObjectPath> ComponentTargetClasses;
+	TMap<TObjectKey<UClass>, bool> ClassReceivesComponents;
+
+	struct FStressTest
+	{
+		TArray<TWeakObjectPtr<AActor>> Actors;
+		bool bBatched = true;
+		double SpawnSeconds = 0.0;
+		double StartSeconds = 0.0;
+		int32 NumFrames = 0;
+		double MaxFrameSeconds = 0.0;
+		double TotalFrameSeconds = 0.0;
+		double MaxSliceSeconds = 0.0;
+	};
+	TOptional<FStressTest> StressTest;
+};
@@ -4,7 +4,9 @@
 
 int8 FExampleVersion::Compare(const FExampleVersion& Reference, const FExampleVersion& Value)
 {
-    // Compare by major number first, and only then by minor number if needed
-    const int8 Sign = FMath::Sign<int8>(Value.MajorVersion - Reference.MajorVersion);
-    return Sign != 0 ? Sign : FMath::Sign<int8>(Value.MinorVersion - Reference.MinorVersion);
+    // Packed keys order by major number first and only then by minor number. Comparing them avoids both the branches
+    // and the overflow of subtracting the components.
+    const uint64 ReferenceKey = Reference.GetPackedKey();
+    const uint64 ValueKey = Value.GetPackedKey();
+    return (int8)(ValueKey > ReferenceKey) - (int8)(ValueKey < ReferenceKey);
 }
@@ -11,14 +11,34 @@ struct BUILDTIMEINCLUDE_API FExampleVersion
 {
 	GENERATED_USTRUCT_BODY()
 
-	FExampleVersion() : MajorVersion(1), MinorVersion(0) {}
-	FExampleVersion(const int32 MajorVersion, const int32 MinorVersion) : MajorVersion(MajorVersion), MinorVersion(MinorVersion) {}
+	constexpr FExampleVersion() : MajorVersion(1), MinorVersion(0) {}
+	constexpr FExampleVersion(const int32 MajorVersion, const int32 MinorVersion) : MajorVersion(MajorVersion), MinorVersion(MinorVersion) {}
 
 	FString ToString() const { return FString::Printf(TEXT("v%d.%d"), MajorVersion, MinorVersion); }
 
 	// -1 if Value < Reference, 0 if Value == Reference, 1 if Value > Reference
 	static int8 Compare(const FExampleVersion& Reference, const FExampleVersion& Value);
 
+	// Single integer that orders the same way as Compare(): major version in the high half, minor version in the low half,
+	// each with the sign bit flipped so negative components sort before positive ones. Compare keys as unsigned.
+	constexpr uint64 GetPackedKey() const
+	{
+		return ((uint64)((uint32)MajorVersion ^ 0x80000000u) << 32) | (uint64)((uint32)MinorVersion ^ 0x80000000u);
+	}
+
+	static constexpr FExampleVersion FromPackedKey(const uint64 PackedKey)
+	{
+		return FExampleVersion((int32)((uint32)(PackedKey >> 32) ^ 0x80000000u), (int32)((uint32)PackedKey ^ 0x80000000u));
+	}
+
+	bool operator==(const FExampleVersion& Other) const { return MajorVersion == Other.MajorVersion && MinorVersion == Other.MinorVersion; }
+	bool operator!=(const FExampleVersion& Other) const { return !(*this == Other); }
+
+	friend FArchive& operator<<(FArchive& Ar, FExampleVersion& Version)
+	{
+		return Ar << Version.MajorVersion << Version.MinorVersion;
+	}
+
 	// Major component of the version number {Major.Minor}
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
 	int32 MajorVersion = 0;
@@ -0,0 +1,126 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleVersionChunks.h"
+#include "ExampleAssetManager.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+void FExampleVersionChunks::Load(const FString& Filename, int32 InFirstChunkId)
+{
+	Chunks.Reset();
+	NextChunkId = InFirstChunkId;
+	NumNewChunks = 0;
+
+	FString Json;
+	TSharedPtr<FJsonObject> Root;
+	if (!FFileHelper::LoadFileToString(Json, *Filename) || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Root) || !Root.IsValid())
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* ChunkValues = nullptr;
+	if (!Root->TryGetArrayField(TEXT("chunks"), ChunkValues))
+	{
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& ChunkValue : *ChunkValues)
+	{
+		const TSharedPtr<FJsonObject>* ChunkObject = nullptr;
+		FString IntroString, SunsetString;
+		FChunk Chunk;
+		if (!ChunkValue->TryGetObject(ChunkObject) || !(*ChunkObject)->TryGetNumberField(TEXT("chunk_id"), Chunk.ChunkId)
+			|| !(*ChunkObject)->TryGetStringField(TEXT("intro"), IntroString) || !UExampleAssetManager::TryParseReleaseVersion(IntroString, Chunk.Range.IntroVersion))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Skipping malformed chunk entry in '%s'."), *Filename);
+			continue;
+		}
+
+		Chunk.Range.bHasSunsetVersion = (*ChunkObject)->TryGetStringField(TEXT("sunset"), SunsetString)
+			&& UExampleAssetManager::TryParseReleaseVersion(SunsetString, Chunk.Range.SunsetVersion);
+		Chunk.Range = Normalize(Chunk.Range);
+		NextChunkId = FMath::Max(NextChunkId, Chunk.ChunkId + 1);
+		Chunks.Add(Chunk.Range, Chunk);
+	}
+}
+
+bool FExampleVersionChunks::Save(const FString& Filename, const FExampleVersion& ReleaseVersion) const
+{
+	TArray<FChunk> SortedChunks;
+	Chunks.GenerateValueArray(SortedChunks);
+	SortedChunks.Sort([](const FChunk& A, const FChunk& B) { return A.ChunkId < B.ChunkId; });
+
+	TArray<TSharedPtr<FJsonValue>> ChunkValues;
+	for (const FChunk& Chunk : SortedChunks)
+	{
+		// Versions are written as X.Y, the same format as ExampleReleaseVersion
+		TSharedRef<FJsonObject> ChunkObject = MakeShared<FJsonObject>();
+		ChunkObject->SetNumberField(TEXT("chunk_id"), Chunk.ChunkId);
+		ChunkObject->SetStringField(TEXT("intro"), FString::Printf(TEXT("%d.%d"), Chunk.Range.IntroVersion.MajorVersion, Chunk.Range.IntroVersion.MinorVersion));
+		if (Chunk.Range.bHasSunsetVersion)
+		{
+			ChunkObject->SetStringField(TEXT("sunset"), FString::Printf(TEXT("%d.%d"), Chunk.Range.SunsetVersion.MajorVersion, Chunk.Range.SunsetVersion.MinorVersion));
+		}
+		// Assets of the last cook, chunks of other releases are kept for id stability but have no assets in this one
+		ChunkObject->SetNumberField(TEXT("num_assets"), Chunk.NumAssets);
+		ChunkValues.Add(MakeShared<FJsonValueObject>(ChunkObject));
+	}
+
+	TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("release_version"), ReleaseVersion.ToString());
+	Root->SetArrayField(TEXT("chunks"), ChunkValues);
+
+	FString Json;
+	return FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json)) && FFileHelper::SaveStringToFile(Json, *Filename);
+}
+
+int32 FExampleVersionChunks::AssignChunk(const FExampleVersionRange& Range)
+{
+	const FExampleVersionRange Key = Normalize(Range);
+	FChunk* Chunk = Chunks.Find(Key);
+	if (!Chunk)
+	{
+		Chunk = &Chunks.Add(Key, FChunk{ NextChunkId++, Key, 0 });
+		++NumNewChunks;
+	}
+	++Chunk->NumAssets;
+	return Chunk->ChunkId;
+}
+
+bool FExampleVersionChunks::IsVersionChunk(int32 ChunkId) const
+{
+	for (const TPair<FExampleVersionRange, FChunk>& Pair : Chunks)
+	{
+		if (Pair.Value.ChunkId == ChunkId)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+FString FExampleVersionChunks::GetInputFilename()
+{
+	FString Filename = FPaths::ProjectDir() / TEXT("Build") / TEXT("ExampleInclusion") / TEXT("VersionChunks.json");
+	FParse::Value(FCommandLine::Get(), TEXT("ExampleVersionChunksInput="), Filename);
+	return Filename;
+}
+
+FString FExampleVersionChunks::GetOutputFilename()
+{
+	FString Filename = FPaths::ProjectSavedDir() / TEXT("ExampleInclusion") / TEXT("VersionChunks.json");
+	FParse::Value(FCommandLine::Get(), TEXT("ExampleVersionChunksOutput="), Filename);
+	return Filename;
+}
+
+FExampleVersionRange FExampleVersionChunks::Normalize(const FExampleVersionRange& Range)
+{
+	FExampleVersionRange Normalized = Range;
+	if (!Normalized.bHasSunsetVersion)
+	{
+		Normalized.SunsetVersion = FExampleVersionRange().SunsetVersion;
+	}
+	return Normalized;
+}
@@ -0,0 +1,52 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExampleVersionRange.h"
+
+/**
+ * Assigns a chunk to every distinct version interval, so content introduced in the same version and sharing the same
+ * sunset version ends up in its own pak/IoStore container. A release's patch then only contains the containers whose
+ * version interval starts or ends at that release, and sunset content can be dropped by removing its containers.
+ *
+ * Chunk ids have to stay stable between releases for that to work, so previous assignments are read from a checked-in
+ * manifest. New intervals get the next free id, existing ones keep theirs. The cook never writes the checked-in manifest,
+ * it writes the updated assignments to Saved (or an explicit output path) for release tooling to pick up and promote.
+ * The manifest also maps each chunk to its version interval for patch and install tooling.
+ */
+class BUILDTIMEINCLUDE_API FExampleVersionChunks
+{
+public:
+	// Read previous assignments, a missing manifest starts fresh at FirstChunkId
+	void Load(const FString& Filename, int32 InFirstChunkId);
+	bool Save(const FString& Filename, const FExampleVersion& ReleaseVersion) const;
+
+	// Chunk of the interval the range spans, assigning a new one if needed. Counts the asset for the manifest.
+	int32 AssignChunk(const FExampleVersionRange& Range);
+
+	// Whether ChunkId was assigned to a version interval, as opposed to set by primary asset rules or labels
+	bool IsVersionChunk(int32 ChunkId) const;
+	// Intervals that weren't in the loaded manifest
+	int32 GetNumNewChunks() const { return NumNewChunks; }
+
+	// Checked-in assignments in the project's Build directory, or -ExampleVersionChunksInput=
+	static FString GetInputFilename();
+	// Assignments of the last cook under Saved, or -ExampleVersionChunksOutput=
+	static FString GetOutputFilename();
+
+private:
+	struct FChunk
+	{
+		int32 ChunkId = INDEX_NONE;
+		FExampleVersionRange Range;
+		int32 NumAssets = 0;
+	};
+
+	// Ranges without sunset version compare equal regardless of their (unused) SunsetVersion value
+	static FExampleVersionRange Normalize(const FExampleVersionRange& Range);
+
+	TMap<FExampleVersionRange, FChunk> Chunks;
+	int32 NextChunkId = 0;
+	int32 NumNewChunks = 0;
+};
@@ -0,0 +1,11 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleVersionGatingTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(ExampleVersionGatingChannel)
+
+TRACE_DECLARE_INT_COUNTER(ExampleVersionGating_AssetsEvaluated, TEXT("ExampleVersionGating/AssetsEvaluated"));
+TRACE_DECLARE_INT_COUNTER(ExampleVersionGating_AssetsIncluded, TEXT("ExampleVersionGating/AssetsIncluded"));
+TRACE_DECLARE_INT_COUNTER(ExampleVersionGating_AssetsExcluded, TEXT("ExampleVersionGating/AssetsExcluded"));
+TRACE_DECLARE_INT_COUNTER(ExampleVersionGating_ActorsMarkedTransient, TEXT("ExampleVersionGating/ActorsMarkedTransient"));
+TRACE_DECLARE_INT_COUNTER(ExampleVersionGating_TagParseFailures, TEXT("ExampleVersionGating/TagParseFailures"));
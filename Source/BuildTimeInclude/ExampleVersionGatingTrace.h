@@ -0,0 +1,40 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+/**
+ * Unreal Insights instrumentation of the version gating pipeline. Scopes and counters are only emitted while the
+ * ExampleVersionGating channel is enabled, otherwise each site costs a single branch on the channel flag.
+ *
+ * For example from a headless cook:
+ *   UnrealEditor-Cmd BuildTimeInclude.uproject -run=cook -targetplatform=Linux -trace=cpu,counters,ExampleVersionGating -tracefile=Cook.utrace
+ */
+UE_TRACE_CHANNEL_EXTERN(ExampleVersionGatingChannel, BUILDTIMEINCLUDE_API)
+
+#if COUNTERSTRACE_ENABLED
+TRACE_DECLARE_INT_COUNTER_EXTERN(ExampleVersionGating_AssetsEvaluated);
+TRACE_DECLARE_INT_COUNTER_EXTERN(ExampleVersionGating_AssetsIncluded);
+TRACE_DECLARE_INT_COUNTER_EXTERN(ExampleVersionGating_AssetsExcluded);
+TRACE_DECLARE_INT_COUNTER_EXTERN(ExampleVersionGating_ActorsMarkedTransient);
+TRACE_DECLARE_INT_COUNTER_EXTERN(ExampleVersionGating_TagParseFailures);
+#endif
+
+// CPU scope with a static name, like EXAMPLE_VERSION_GATING_SCOPE(ApplyPrimaryAssetLabels)
+#define EXAMPLE_VERSION_GATING_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, ExampleVersionGatingChannel)
+// CPU scope with a runtime name. Name is only evaluated while the channel is enabled.
+#define EXAMPLE_VERSION_GATING_SCOPE_TEXT(Name) TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(UE_TRACE_CHANNELEXPR_IS_ENABLED(ExampleVersionGatingChannel) ? (Name) : TEXT(""), ExampleVersionGatingChannel)
+
+// Add to one of the counters above. Callers in loops accumulate locally and add once.
+#define EXAMPLE_VERSION_GATING_COUNTER_ADD(Counter, Amount) \
+	do \
+	{ \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(ExampleVersionGatingChannel)) \
+		{ \
+			TRACE_COUNTER_ADD(ExampleVersionGating_##Counter, Amount); \
+		} \
+	} while (0)
@@ -0,0 +1,147 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleVersionIntervalIndex.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+
+namespace ExampleVersionIntervalIndex
+{
+	// Strict weak ordering matching FExampleVersion::Compare
+	static bool IsVersionLess(const FExampleVersion& A, const FExampleVersion& B)
+	{
+		return A.GetPackedKey() < B.GetPackedKey();
+	}
+
+	// Whether Lower < Version <= Upper
+	static bool IsVersionInHalfOpenRange(const FExampleVersion& Version, const FExampleVersion& Lower, const FExampleVersion& Upper)
+	{
+		return IsVersionLess(Lower, Version) && !IsVersionLess(Upper, Version);
+	}
+}
+
+void FExampleVersionIntervalIndex::Build(TConstArrayView<FPrimaryAssetId> InAssetIds, TConstArrayView<FExampleVersionRange> InRanges)
+{
+	using namespace ExampleVersionIntervalIndex;
+	check(InAssetIds.Num() == InRanges.Num());
+
+	AssetIds = InAssetIds;
+	Ranges = InRanges;
+	IntroOrder.Reset();
+	SunsetOrder.Reset();
+	Boundaries.Reset();
+	SegmentInclusion.Reset();
+
+	for (int32 AssetIndex = 0; AssetIndex < Ranges.Num(); ++AssetIndex)
+	{
+		const FExampleVersionRange& Range = Ranges[AssetIndex];
+
+		// A sunset at or before the intro version means the asset is never included, it can't change inclusion either
+		if (Range.bHasSunsetVersion && !IsVersionLess(Range.IntroVersion, Range.SunsetVersion))
+		{
+			continue;
+		}
+
+		IntroOrder.Add(AssetIndex);
+		Boundaries.Add(Range.IntroVersion);
+		if (Range.bHasSunsetVersion)
+		{
+			SunsetOrder.Add(AssetIndex);
+			Boundaries.Add(Range.SunsetVersion);
+		}
+	}
+
+	IntroOrder.StableSort([this](int32 A, int32 B) { return IsVersionLess(Ranges[A].IntroVersion, Ranges[B].IntroVersion); });
+	SunsetOrder.StableSort([this](int32 A, int32 B) { return IsVersionLess(Ranges[A].SunsetVersion, Ranges[B].SunsetVersion); });
+
+	Boundaries.Sort(&IsVersionLess);
+	Boundaries.SetNum(Algo::Unique(Boundaries));
+
+	// Sweep the segments in order, each segment's set is the previous one plus intros minus sunsets at its boundary
+	SegmentInclusion.SetNum(Boundaries.Num());
+	TBitArray<> Included(false, Ranges.Num());
+	int32 NextIntro = 0;
+	int32 NextSunset = 0;
+	for (int32 SegmentIndex = 0; SegmentIndex < Boundaries.Num(); ++SegmentIndex)
+	{
+		const FExampleVersion& Boundary = Boundaries[SegmentIndex];
+		for (; NextIntro < IntroOrder.Num() && Ranges[IntroOrder[NextIntro]].IntroVersion == Boundary; ++NextIntro)
+		{
+			Included[IntroOrder[NextIntro]] = true;
+		}
+		for (; NextSunset < SunsetOrder.Num() && Ranges[SunsetOrder[NextSunset]].SunsetVersion == Boundary; ++NextSunset)
+		{
+			Included[SunsetOrder[NextSunset]] = false;
+		}
+		SegmentInclusion[SegmentIndex] = Included;
+	}
+}
+
+int32 FExampleVersionIntervalIndex::FindSegment(const FExampleVersion& Version) const
+{
+	// Last boundary at or before Version, INDEX_NONE if Version predates all content
+	return Algo::UpperBound(Boundaries, Version, &ExampleVersionIntervalIndex::IsVersionLess) - 1;
+}
+
+int32 FExampleVersionIntervalIndex::CountIncludedAssets(const FExampleVersion& Version) const
+{
+	using namespace ExampleVersionIntervalIndex;
+
+	// Sunset versions are always after intro versions, so everything sunset by now was also introduced by now
+	const int32 NumIntroduced = Algo::UpperBoundBy(IntroOrder, Version, [this](int32 AssetIndex) { return Ranges[AssetIndex].IntroVersion; }, &IsVersionLess);
+	const int32 NumSunset = Algo::UpperBoundBy(SunsetOrder, Version, [this](int32 AssetIndex) { return Ranges[AssetIndex].SunsetVersion; }, &IsVersionLess);
+	return NumIntroduced - NumSunset;
+}
+
+void FExampleVersionIntervalIndex::GetIncludedAssets(const FExampleVersion& Version, TArray<FPrimaryAssetId>& OutAssetIds) const
+{
+	OutAssetIds.Reset();
+	const int32 SegmentIndex = FindSegment(Version);
+	if (SegmentIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	OutAssetIds.Reserve(CountIncludedAssets(Version));
+	for (TConstSetBitIterator<> It(SegmentInclusion[SegmentIndex]); It; ++It)
+	{
+		OutAssetIds.Add(AssetIds[It.GetIndex()]);
+	}
+}
+
+void FExampleVersionIntervalIndex::GetChangedAssets(const FExampleVersion& FromVersion, const FExampleVersion& ToVersion, TArray<FPrimaryAssetId>& OutAddedAssetIds, TArray<FPrimaryAssetId>& OutRemovedAssetIds) const
+{
+	using namespace ExampleVersionIntervalIndex;
+	OutAddedAssetIds.Reset();
+	OutRemovedAssetIds.Reset();
+
+	// Going from Lower to Upper, an asset changes inclusion if exactly one of its intro and sunset version lies in (Lower, Upper].
+	// If both do, it was introduced and sunset in between and is excluded at both versions.
+	const bool bForward = !IsVersionLess(ToVersion, FromVersion);
+	const FExampleVersion& Lower = bForward ? FromVersion : ToVersion;
+	const FExampleVersion& Upper = bForward ? ToVersion : FromVersion;
+	TArray<FPrimaryAssetId>& OutIntroduced = bForward ? OutAddedAssetIds : OutRemovedAssetIds;
+	TArray<FPrimaryAssetId>& OutSunset = bForward ? OutRemovedAssetIds : OutAddedAssetIds;
+
+	auto GetIntroVersion = [this](int32 AssetIndex) { return Ranges[AssetIndex].IntroVersion; };
+	const int32 FirstIntro = Algo::UpperBoundBy(IntroOrder, Lower, GetIntroVersion, &IsVersionLess);
+	const int32 EndIntro = Algo::UpperBoundBy(IntroOrder, Upper, GetIntroVersion, &IsVersionLess);
+	for (int32 OrderIndex = FirstIntro; OrderIndex < EndIntro; ++OrderIndex)
+	{
+		const FExampleVersionRange& Range = Ranges[IntroOrder[OrderIndex]];
+		if (!Range.bHasSunsetVersion || !IsVersionInHalfOpenRange(Range.SunsetVersion, Lower, Upper))
+		{
+			OutIntroduced.Add(AssetIds[IntroOrder[OrderIndex]]);
+		}
+	}
+
+	auto GetSunsetVersion = [this](int32 AssetIndex) { return Ranges[AssetIndex].SunsetVersion; };
+	const int32 FirstSunset = Algo::UpperBoundBy(SunsetOrder, Lower, GetSunsetVersion, &IsVersionLess);
+	const int32 EndSunset = Algo::UpperBoundBy(SunsetOrder, Upper, GetSunsetVersion, &IsVersionLess);
+	for (int32 OrderIndex = FirstSunset; OrderIndex < EndSunset; ++OrderIndex)
+	{
+		if (!IsVersionInHalfOpenRange(Ranges[SunsetOrder[OrderIndex]].IntroVersion, Lower, Upper))
+		{
+			OutSunset.Add(AssetIds[SunsetOrder[OrderIndex]]);
+		}
+	}
+}
@@ -0,0 +1,50 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/PrimaryAssetId.h"
+#include "ExampleVersionRange.h"
+
+/**
+ * In-memory index over the version ranges of all versioned assets, answering release management questions
+ * without running a cook:
+ * - Which assets are included at version X, answered from a precomputed inclusion set per version segment.
+ * - Which assets change inclusion between version X and Y, answered by binary searching assets sorted by
+ *   intro and by sunset version, so the cost depends on the number of changed assets, not the registry size.
+ *
+ * Uses the same semantics as FExampleVersionRange::DoesRangeInclude: intro version inclusive, sunset version exclusive.
+ */
+class BUILDTIMEINCLUDE_API FExampleVersionIntervalIndex
+{
+public:
+	// AssetIds and Ranges must match by index
+	void Build(TConstArrayView<FPrimaryAssetId> InAssetIds, TConstArrayView<FExampleVersionRange> InRanges);
+
+	int32 Num() const { return AssetIds.Num(); }
+
+	// Number of assets included at Version
+	int32 CountIncludedAssets(const FExampleVersion& Version) const;
+
+	// All assets included at Version
+	void GetIncludedAssets(const FExampleVersion& Version, TArray<FPrimaryAssetId>& OutAssetIds) const;
+
+	// Assets whose inclusion differs between FromVersion and ToVersion. Added assets are excluded at FromVersion and
+	// included at ToVersion, removed assets the other way around. FromVersion may be newer than ToVersion.
+	void GetChangedAssets(const FExampleVersion& FromVersion, const FExampleVersion& ToVersion, TArray<FPrimaryAssetId>& OutAddedAssetIds, TArray<FPrimaryAssetId>& OutRemovedAssetIds) const;
+
+	// Distinct intro and sunset versions in ascending order, inclusion can only change at these versions
+	const TArray<FExampleVersion>& GetBoundaries() const { return Boundaries; }
+
+private:
+	int32 FindSegment(const FExampleVersion& Version) const;
+
+	TArray<FPrimaryAssetId> AssetIds;
+	TArray<FExampleVersionRange> Ranges;
+	// Asset indices sorted by intro version, and sorted by sunset version for assets that have one
+	TArray<int32> IntroOrder;
+	TArray<int32> SunsetOrder;
+	// Segment i spans [Boundaries[i], Boundaries[i + 1]), inclusion is constant within a segment
+	TArray<FExampleVersion> Boundaries;
+	TArray<TBitArray<>> SegmentInclusion;
+};
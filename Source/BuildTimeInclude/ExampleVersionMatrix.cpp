@@ -0,0 +1,184 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleVersionMatrix.h"
+#include "ExampleAssetManager.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
+
+namespace ExampleVersionMatrix
+{
+	static constexpr uint32 FileMagic = 0x4D565845; // 'EXVM'
+	static constexpr uint32 FileVersion = 1;
+}
+
+bool FExampleVersionMatrix::Build(TConstArrayView<FExampleVersion> InVersions, TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions)
+{
+	check(Assets.Num() == Decisions.Num());
+
+	Versions = InVersions;
+	AssetIds.Reset(Assets.Num());
+	TagValueHashes.Reset(Assets.Num());
+	RangeIndices.Reset(Assets.Num());
+	Ranges.Reset();
+	Inclusion.Reset();
+	Inclusion.SetNum(Versions.Num());
+
+	TMap<FExampleVersionRange, uint16> RangeToIndex;
+	FExampleVersionRangeBatch RangeBatch;
+	RangeBatch.Reserve(Assets.Num());
+	for (int32 AssetIndex = 0; AssetIndex < Assets.Num(); ++AssetIndex)
+	{
+		const FExampleAssetInclusionDecision& Decision = Decisions[AssetIndex];
+		if (!Decision.bHasVersionRange)
+		{
+			// Left out on purpose, per-version cooks will evaluate and report it themselves
+			continue;
+		}
+
+		uint16* RangeIndex = RangeToIndex.Find(Decision.VersionRange);
+		if (!RangeIndex)
+		{
+			if (Ranges.Num() > MAX_uint16)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Version matrix supports at most %d distinct version ranges."), MAX_uint16 + 1);
+				return false;
+			}
+			RangeIndex = &RangeToIndex.Add(Decision.VersionRange, (uint16)Ranges.Add(Decision.VersionRange));
+		}
+
+		AssetIds.Add(Assets[AssetIndex].GetPrimaryAssetId());
+		TagValueHashes.Add(Decision.TagValueHash);
+		RangeIndices.Add(*RangeIndex);
+		RangeBatch.Add(Decision.VersionRange);
+	}
+
+	// Evaluate all ranges against one version at a time
+	TArray<uint8> Included;
+	Included.SetNumUninitialized(RangeBatch.Num());
+	for (int32 VersionIndex = 0; VersionIndex < Versions.Num(); ++VersionIndex)
+	{
+		RangeBatch.Evaluate(Versions[VersionIndex], Included.GetData());
+		// Pack whole words instead of going through TBitArray's per-bit reference proxy
+		Inclusion[VersionIndex].Init(false, Included.Num());
+		uint32* InclusionWords = Inclusion[VersionIndex].GetData();
+		for (int32 AssetIndex = 0; AssetIndex < Included.Num(); ++AssetIndex)
+		{
+			InclusionWords[AssetIndex >> 5] |= uint32(Included[AssetIndex]) << (AssetIndex & 31);
+		}
+	}
+
+	RebuildAssetIndexMap();
+	return true;
+}
+
+int32 FExampleVersionMatrix::FindVersionIndex(const FExampleVersion& Version) const
+{
+	return Versions.IndexOfByKey(Version);
+}
+
+bool FExampleVersionMatrix::TryGetDecision(const FPrimaryAssetId& AssetId, uint32 TagValueHash, int32 VersionIndex, FExampleVersionRange& OutRange, bool& bOutIncluded) const
+{
+	const int32* AssetIndex = AssetIndexMap.Find(AssetId);
+	if (!AssetIndex || !Inclusion.IsValidIndex(VersionIndex) || TagValueHashes[*AssetIndex] != TagValueHash)
+	{
+		return false;
+	}
+
+	OutRange = Ranges[RangeIndices[*AssetIndex]];
+	bOutIncluded = Inclusion[VersionIndex][*AssetIndex];
+	return true;
+}
+
+bool FExampleVersionMatrix::SaveToFile(const FString& Filename) const
+{
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!Writer)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to open version matrix '%s' for writing."), *Filename);
+		return false;
+	}
+
+	const_cast<FExampleVersionMatrix*>(this)->Serialize(*Writer);
+	return Writer->Close();
+}
+
+bool FExampleVersionMatrix::LoadFromFile(const FString& Filename)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Filename));
+	if (!Reader)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to open version matrix '%s' for reading."), *Filename);
+		return false;
+	}
+
+	Serialize(*Reader);
+	if (Reader->IsError())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Version matrix '%s' is corrupt or was written by an incompatible version."), *Filename);
+		*this = FExampleVersionMatrix();
+		return false;
+	}
+
+	RebuildAssetIndexMap();
+	return true;
+}
+
+FString FExampleVersionMatrix::GetDefaultFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("ExampleInclusion") / TEXT("VersionMatrix.bin");
+}
+
+void FExampleVersionMatrix::Serialize(FArchive& Ar)
+{
+	uint32 Magic = ExampleVersionMatrix::FileMagic;
+	uint32 Version = ExampleVersionMatrix::FileVersion;
+	Ar << Magic << Version;
+	if (Magic != ExampleVersionMatrix::FileMagic || Version != ExampleVersionMatrix::FileVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	// Primary asset ids are written as strings, FName serialization isn't portable for plain file archives
+	int32 NumAssets = AssetIds.Num();
+	Ar << NumAssets;
+	if (Ar.IsLoading())
+	{
+		if (NumAssets < 0)
+		{
+			Ar.SetError();
+			return;
+		}
+		AssetIds.SetNum(NumAssets);
+	}
+	for (FPrimaryAssetId& AssetId : AssetIds)
+	{
+		FString Type = AssetId.PrimaryAssetType.ToString();
+		FString Name = AssetId.PrimaryAssetName.ToString();
+		Ar << Type << Name;
+		if (Ar.IsLoading())
+		{
+			AssetId = FPrimaryAssetId(FPrimaryAssetType(*Type), FName(*Name));
+		}
+	}
+
+	Ar << Versions << TagValueHashes << RangeIndices << Ranges << Inclusion;
+
+	// Reject files whose per-asset arrays don't line up
+	if (Ar.IsLoading() && (TagValueHashes.Num() != NumAssets || RangeIndices.Num() != NumAssets || Inclusion.Num() != Versions.Num()
+		|| Inclusion.ContainsByPredicate([NumAssets](const TBitArray<>& Bits) { return Bits.Num() != NumAssets; })
+		|| RangeIndices.ContainsByPredicate([this](uint16 RangeIndex) { return !Ranges.IsValidIndex(RangeIndex); })))
+	{
+		Ar.SetError();
+	}
+}
+
+void FExampleVersionMatrix::RebuildAssetIndexMap()
+{
+	AssetIndexMap.Reset();
+	AssetIndexMap.Reserve(AssetIds.Num());
+	for (int32 AssetIndex = 0; AssetIndex < AssetIds.Num(); ++AssetIndex)
+	{
+		AssetIndexMap.Add(AssetIds[AssetIndex], AssetIndex);
+	}
+}
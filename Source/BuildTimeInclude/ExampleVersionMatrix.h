@@ -0,0 +1,55 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/PrimaryAssetId.h"
+#include "ExampleVersionRange.h"
+
+struct FExampleAssetInclusionDecision;
+
+/**
+ * Inclusion decisions of all versioned primary assets for several release versions at once, for example
+ * live, next and QA-next. Produced by UExampleVersionMatrixCommandlet from a single asset registry scan, and
+ * loaded by per-version cooks through -ExampleVersionMatrix=<path> instead of evaluating every asset again.
+ *
+ * Each asset stores a hash of its VersionRange tag value, so assets that were edited after the matrix was
+ * written are detected and evaluated normally.
+ */
+struct BUILDTIMEINCLUDE_API FExampleVersionMatrix
+{
+	// Release versions the matrix was evaluated for
+	TArray<FExampleVersion> Versions;
+	// Evaluated assets, all per-asset arrays below are indexed the same way
+	TArray<FPrimaryAssetId> AssetIds;
+	// FExampleVersionRange::HashAssetTagValue of the asset's tag value at the time of evaluation
+	TArray<uint32> TagValueHashes;
+	// Index into Ranges of the asset's decoded version range
+	TArray<uint16> RangeIndices;
+	// Distinct version ranges, thousands of assets typically share only a handful
+	TArray<FExampleVersionRange> Ranges;
+	// One bit per asset for each entry in Versions, set if the asset is included in that version
+	TArray<TBitArray<>> Inclusion;
+
+	// Evaluate every decoded asset range against all Versions. Decisions must match Assets by index.
+	bool Build(TConstArrayView<FExampleVersion> InVersions, TConstArrayView<FAssetData> Assets, TConstArrayView<FExampleAssetInclusionDecision> Decisions);
+
+	// INDEX_NONE if the matrix wasn't evaluated for this version
+	int32 FindVersionIndex(const FExampleVersion& Version) const;
+
+	// Look up a precomputed decision. Fails if the asset is unknown or its tag value changed since evaluation.
+	bool TryGetDecision(const FPrimaryAssetId& AssetId, uint32 TagValueHash, int32 VersionIndex, FExampleVersionRange& OutRange, bool& bOutIncluded) const;
+
+	bool SaveToFile(const FString& Filename) const;
+	bool LoadFromFile(const FString& Filename);
+
+	// Default location, relative to the project's Saved directory
+	static FString GetDefaultFilename();
+
+private:
+	void Serialize(FArchive& Ar);
+	void RebuildAssetIndexMap();
+
+	TMap<FPrimaryAssetId, int32> AssetIndexMap;
+};
@@ -0,0 +1,83 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleVersionMatrixCommandlet.h"
+#include "ExampleAssetManager.h"
+#include "ExampleVersionMatrix.h"
+#include "ExampleVersionRangeCache.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+UExampleVersionMatrixCommandlet::UExampleVersionMatrixCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UExampleVersionMatrixCommandlet::Main(const FString& Params)
+{
+	// Parse the list of release versions to evaluate
+	FString VersionsParam;
+	if (!FParse::Value(*Params, TEXT("Versions="), VersionsParam, false))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Missing -Versions=X.Y,X.Y,... argument."));
+		return 1;
+	}
+
+	TArray<FString> VersionTokens;
+	VersionsParam.ParseIntoArray(VersionTokens, TEXT(","));
+	TArray<FExampleVersion> Versions;
+	for (const FString& VersionToken : VersionTokens)
+	{
+		FExampleVersion Version;
+		if (!UExampleAssetManager::TryParseReleaseVersion(VersionToken.TrimStartAndEnd(), Version))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to parse release version '%s'."), *VersionToken);
+			return 1;
+		}
+		Versions.AddUnique(Version);
+	}
+	if (Versions.IsEmpty())
+	{
+		UE_LOG(LogTemp, Error, TEXT("-Versions= didn't contain any release version."));
+		return 1;
+	}
+
+	FString OutputFilename = FExampleVersionMatrix::GetDefaultFilename();
+	FParse::Value(*Params, TEXT("Output="), OutputFilename);
+
+	UExampleAssetManager* AssetManager = Cast<UExampleAssetManager>(UAssetManager::GetIfInitialized());
+	if (!AssetManager)
+	{
+		UE_LOG(LogTemp, Error, TEXT("The project's asset manager must be UExampleAssetManager."));
+		return 1;
+	}
+
+	// Make sure the primary asset directory reflects everything on disk
+	IAssetRegistry::GetChecked().SearchAllAssets(true);
+#if WITH_EDITOR
+	AssetManager->RefreshPrimaryAssetDirectory(true);
+#endif
+
+	// Single scan: decode every asset's range once, then evaluate it against all versions
+	TArray<FAssetData> VersionedAssets;
+	AssetManager->GatherVersionedAssets(VersionedAssets);
+
+	FExampleVersionRangeDecodeCache DecodeCache;
+	TArray<FExampleAssetInclusionDecision> Decisions;
+	UExampleAssetManager::EvaluateVersionedAssets(VersionedAssets, Versions[0], DecodeCache, true, Decisions);
+
+	FExampleVersionMatrix Matrix;
+	if (!Matrix.Build(Versions, VersionedAssets, Decisions) || !Matrix.SaveToFile(OutputFilename))
+	{
+		return 1;
+	}
+
+	for (int32 VersionIndex = 0; VersionIndex < Versions.Num(); ++VersionIndex)
+	{
+		UE_LOG(LogTemp, Display, TEXT("  %s: %d of %d assets included"), *Versions[VersionIndex].ToString(),
+			Matrix.Inclusion[VersionIndex].CountSetBits(), Matrix.AssetIds.Num());
+	}
+	UE_LOG(LogTemp, Display, TEXT("Wrote version matrix for %d versions and %d assets to '%s'"), Versions.Num(), Matrix.AssetIds.Num(), *OutputFilename);
+	return 0;
+}
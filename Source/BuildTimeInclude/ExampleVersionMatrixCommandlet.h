@@ -0,0 +1,25 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ExampleVersionMatrixCommandlet.generated.h"
+
+/**
+ * Evaluates every versioned primary asset against several release versions in a single asset registry scan and
+ * writes the per-version inclusion bitsets to an FExampleVersionMatrix file. Per-version cooks can then pass
+ * -ExampleVersionMatrix=<path> to reuse the decisions instead of evaluating all assets again.
+ *
+ * Usage: UnrealEditor-Cmd BuildTimeInclude.uproject -run=ExampleVersionMatrix -Versions=4.0,4.1,5.0 [-Output=<path>]
+ */
+UCLASS()
+class BUILDTIMEINCLUDE_API UExampleVersionMatrixCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UExampleVersionMatrixCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,77 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleVersionQueryCommandlet.h"
+#include "ExampleAssetManager.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+namespace ExampleVersionQueryCommandlet
+{
+	static bool TryParseVersionParam(const FString& Params, const TCHAR* ParamName, FExampleVersion& OutVersion)
+	{
+		FString Value;
+		return FParse::Value(*Params, ParamName, Value) && UExampleAssetManager::TryParseReleaseVersion(Value, OutVersion);
+	}
+
+	static void LogAssetIds(const TCHAR* Label, const TArray<FPrimaryAssetId>& AssetIds, bool bCountOnly)
+	{
+		UE_LOG(LogTemp, Display, TEXT("%s: %d assets"), Label, AssetIds.Num());
+		if (!bCountOnly)
+		{
+			for (const FPrimaryAssetId& AssetId : AssetIds)
+			{
+				UE_LOG(LogTemp, Display, TEXT("  %s"), *AssetId.ToString());
+			}
+		}
+	}
+}
+
+UExampleVersionQueryCommandlet::UExampleVersionQueryCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UExampleVersionQueryCommandlet::Main(const FString& Params)
+{
+	using namespace ExampleVersionQueryCommandlet;
+
+	UExampleAssetManager* AssetManager = Cast<UExampleAssetManager>(UAssetManager::GetIfInitialized());
+	if (!AssetManager)
+	{
+		UE_LOG(LogTemp, Error, TEXT("The project's asset manager must be UExampleAssetManager."));
+		return 1;
+	}
+
+	// Make sure the primary asset directory reflects everything on disk
+	IAssetRegistry::GetChecked().SearchAllAssets(true);
+#if WITH_EDITOR
+	AssetManager->RefreshPrimaryAssetDirectory(true);
+#endif
+
+	const FExampleVersionIntervalIndex& Index = AssetManager->GetVersionIntervalIndex(true);
+	UE_LOG(LogTemp, Display, TEXT("Indexed %d versioned assets, inclusion changes at %d distinct versions"), Index.Num(), Index.GetBoundaries().Num());
+
+	const bool bCountOnly = FParse::Param(*Params, TEXT("CountOnly"));
+	FExampleVersion AtVersion, FromVersion, ToVersion;
+	if (TryParseVersionParam(Params, TEXT("At="), AtVersion))
+	{
+		TArray<FPrimaryAssetId> IncludedAssetIds;
+		AssetManager->GetAssetsIncludedAtVersion(AtVersion, IncludedAssetIds);
+		LogAssetIds(*FString::Printf(TEXT("Included at %s"), *AtVersion.ToString()), IncludedAssetIds, bCountOnly);
+		return 0;
+	}
+
+	if (TryParseVersionParam(Params, TEXT("From="), FromVersion) && TryParseVersionParam(Params, TEXT("To="), ToVersion))
+	{
+		TArray<FPrimaryAssetId> AddedAssetIds, RemovedAssetIds;
+		AssetManager->GetAssetsChangedBetweenVersions(FromVersion, ToVersion, AddedAssetIds, RemovedAssetIds);
+		LogAssetIds(*FString::Printf(TEXT("Added from %s to %s"), *FromVersion.ToString(), *ToVersion.ToString()), AddedAssetIds, bCountOnly);
+		LogAssetIds(*FString::Printf(TEXT("Removed from %s to %s"), *FromVersion.ToString(), *ToVersion.ToString()), RemovedAssetIds, bCountOnly);
+		return 0;
+	}
+
+	UE_LOG(LogTemp, Error, TEXT("Expected either -At=X.Y or -From=X.Y -To=X.Y."));
+	return 1;
+}
@@ -0,0 +1,28 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ExampleVersionQueryCommandlet.generated.h"
+
+/**
+ * Answers release management questions from the asset registry, without running a cook:
+ *
+ * Which assets are included at a version:
+ *   UnrealEditor-Cmd BuildTimeInclude.uproject -run=ExampleVersionQuery -At=4.0
+ * Which assets change inclusion between two versions, for example to size a patch:
+ *   UnrealEditor-Cmd BuildTimeInclude.uproject -run=ExampleVersionQuery -From=4.0 -To=5.0
+ *
+ * Add -CountOnly to only print the totals.
+ */
+UCLASS()
+class BUILDTIMEINCLUDE_API UExampleVersionQueryCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UExampleVersionQueryCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -23,16 +23,51 @@ struct BUILDTIMEINCLUDE_API FExampleVersionRange
 
 	// The key that assets store their version range as and the asset manager will look for.
 	static FName AssetTagName;
-	// Custom to string implementation. Matches the FStructProperty::ExportText_Internal() implementation.
+	// Custom to string implementation. Compact Intro..Sunset form, like 4.0..5.2, or 4.0.. without sunset version.
 	static FString ToAssetTagValue(const FExampleVersionRange& Range);
-	// Custom from string implementation. Can parse what ToAssetTagValue() outputs.
+	// Struct text as FStructProperty::ExportText_Internal() writes it, which assets saved before the compact form carry.
+	static FString ToLegacyAssetTagValue(const FExampleVersionRange& Range);
+	// Custom from string implementation. Can parse what ToAssetTagValue() and ToLegacyAssetTagValue() output.
 	static FExampleVersionRange FromAssetTagValue(const FString& Value);
+	// Allocation-free parser for the exact formats ToAssetTagValue() and ToLegacyAssetTagValue() emit. Returns false for
+	// anything else (hand-edited values), in which case callers should fall back to FromAssetTagValue().
+	static bool TryParseAssetTagValue(FStringView Value, FExampleVersionRange& OutRange);
+	// Case insensitive hash of a tag value, used to detect assets whose range changed since a decision was stored. Tag values
+	// are usually read as FName, which returns whichever casing was interned first, so casing can't be part of the hash.
+	// It carries no meaning in either tag format anyway.
+	static uint32 HashAssetTagValue(FStringView Value);
+	// Same hash for a tag value read as FName, without allocating
+	static uint32 HashAssetTagValue(FName Value);
 
 	// Human readable string representation
 	FString ToString() const;
 
 	// Whether a specific version is contained within the configured (intro version, optional sunset version) range.
-	bool DoesRangeInclude(const FExampleVersion& Version) const;
+	bool DoesRangeInclude(const FExampleVersion& Version) const { return DoesRangeIncludeKey(Version.GetPackedKey()); }
+	// Same for a version in FExampleVersion::GetPackedKey form
+	bool DoesRangeIncludeKey(uint64 VersionKey) const
+	{
+		// Intro version inclusive, sunset version exclusive. Evaluates both sides without short-circuiting so this stays branchless.
+		return (VersionKey >= IntroVersion.GetPackedKey()) & ((VersionKey < SunsetVersion.GetPackedKey()) | !bHasSunsetVersion);
+	}
+
+	bool operator==(const FExampleVersionRange& Other) const
+	{
+		return IntroVersion == Other.IntroVersion && bHasSunsetVersion == Other.bHasSunsetVersion && SunsetVersion == Other.SunsetVersion;
+	}
+
+	friend uint32 GetTypeHash(const FExampleVersionRange& Range)
+	{
+		uint32 Hash = HashCombine(GetTypeHash(Range.IntroVersion.MajorVersion), GetTypeHash(Range.IntroVersion.MinorVersion));
+		Hash = HashCombine(Hash, GetTypeHash(Range.bHasSunsetVersion));
+		Hash = HashCombine(Hash, GetTypeHash(Range.SunsetVersion.MajorVersion));
+		return HashCombine(Hash, GetTypeHash(Range.SunsetVersion.MinorVersion));
+	}
+
+	friend FArchive& operator<<(FArchive& Ar, FExampleVersionRange& Range)
+	{
+		return Ar << Range.IntroVersion << Range.bHasSunsetVersion << Range.SunsetVersion;
+	}
 
 	// If the build's game version is at least this, consider for inclusion.
 	UPROPERTY(EditAnywhere, BlueprintReadOnly)
@@ -48,4 +83,31 @@ struct BUILDTIMEINCLUDE_API FExampleVersionRange
 	
 };
 
+/**
+ * Structure of arrays of version ranges in packed key form, for evaluating many ranges against one version at once.
+ * Each range is stored as its intro key plus the number of keys it spans, so inclusion is a single unsigned compare
+ * per range and the evaluation loop has no branches. Most of the gain over per-range DoesRangeInclude comes from
+ * removing the branches. Whether the loop is also vectorized depends on compiler and optimization level, the
+ * range_soa_batch stage of -run=ExampleInclusionBenchmark measures it on the actual build.
+ *
+ * The maximum packed key (vMAX_int32.MAX_int32) is reserved: ranges without sunset version never include it.
+ */
+struct BUILDTIMEINCLUDE_API FExampleVersionRangeBatch
+{
+	// Packed key of each range's intro version
+	TArray<uint64> IntroKeys;
+	// Packed sunset key minus intro key, 0 for empty ranges
+	TArray<uint64> Widths;
+
+	void Reserve(int32 Num);
+	int32 Add(const FExampleVersionRange& Range);
+	int32 Num() const { return IntroKeys.Num(); }
+
+	// Writes 1 to OutIncluded[i] if range i includes Version, 0 otherwise. OutIncluded must hold Num() entries.
+	void Evaluate(const FExampleVersion& Version, uint8* OutIncluded) const;
+
+	// Same as Evaluate, for callers that keep their own SoA arrays
+	static void EvaluatePacked(const uint64* RESTRICT IntroKeys, const uint64* RESTRICT Widths, int32 Num, uint64 VersionKey, uint8* RESTRICT OutIncluded);
+};
+
 BUILDTIMEINCLUDE_API void LexFromString(FExampleVersionRange& OutValue, const TCHAR* Buffer);
\ No newline at end of file
@@ -0,0 +1,44 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleVersionRangeCache.h"
+#include "ExampleVersionGatingTrace.h"
+
+FName FExampleVersionRangeDecodeCache::GetTagValueName(const FAssetData& AssetData)
+{
+	// Cooked registries already store short values as names, editor registries intern the stored string once
+	const FAssetTagValueRef TagValue = AssetData.TagsAndValues.FindTag(FExampleVersionRange::AssetTagName);
+	return TagValue.IsSet() ? TagValue.AsName() : NAME_None;
+}
+
+bool FExampleVersionRangeDecodeCache::TryGetVersionRange(const FAssetData& AssetData, FExampleVersionRange& OutRange)
+{
+	const FName TagValue = GetTagValueName(AssetData);
+	if (TagValue.IsNone())
+	{
+		return false;
+	}
+
+	OutRange = Decode(TagValue).Range;
+	return true;
+}
+
+int32 FExampleVersionRangeDecodeCache::FindOrDecode(FName TagValue)
+{
+	if (const int32* EntryIndex = EntryIndices.Find(TagValue))
+	{
+		++NumHits;
+		return *EntryIndex;
+	}
+
+	EXAMPLE_VERSION_GATING_SCOPE(FExampleVersionRangeDecodeCache_Decode);
+	TStringBuilder<128> TagValueString;
+	TagValue.AppendString(TagValueString);
+	FEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.TagValueHash = FExampleVersionRange::HashAssetTagValue(TagValue);
+	if (!FExampleVersionRange::TryParseAssetTagValue(TagValueString.ToView(), Entry.Range))
+	{
+		++NumLegacyMisses;
+		Entry.Range = FExampleVersionRange::FromAssetTagValue(FString(TagValueString.ToView()));
+	}
+	return EntryIndices.Add(TagValue, Entries.Num() - 1);
+}
@@ -0,0 +1,53 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "ExampleVersionRange.h"
+
+/**
+ * Decodes the VersionRange asset tag of FAssetData, memoizing the result per distinct tag value.
+ * Large registries contain thousands of assets that share the same handful of ranges, so after the
+ * first asset of each range, decoding is a single map lookup instead of a text parse.
+ *
+ * Tag values are read as FName, so the cache is keyed by the name table's interned value. Looking up an asset
+ * doesn't copy its tag value into a string, and the key hashes as an integer.
+ *
+ * Not thread-safe. Parallel callers decode the distinct values of a batch up front and only read entries afterwards,
+ * see UExampleAssetManager::EvaluateVersionedAssets.
+ */
+class BUILDTIMEINCLUDE_API FExampleVersionRangeDecodeCache
+{
+public:
+	struct FEntry
+	{
+		FExampleVersionRange Range;
+		// FExampleVersionRange::HashAssetTagValue of the tag value
+		uint32 TagValueHash = 0;
+	};
+
+	// The asset's VersionRange tag value, NAME_None if it doesn't have the tag. Doesn't touch the cache, safe from any thread.
+	static FName GetTagValueName(const FAssetData& AssetData);
+
+	// Returns false if the asset doesn't have a VersionRange tag at all.
+	bool TryGetVersionRange(const FAssetData& AssetData, FExampleVersionRange& OutRange);
+
+	// Index of the entry for a tag value from GetTagValueName(), decoding it on first use. Indices stay valid for the cache's lifetime.
+	int32 FindOrDecode(FName TagValue);
+	// Safe to call from multiple threads while nobody calls FindOrDecode
+	const FEntry& GetEntry(int32 EntryIndex) const { return Entries[EntryIndex]; }
+	const FEntry& Decode(FName TagValue) { return Entries[FindOrDecode(TagValue)]; }
+
+	int32 GetNumDistinctValues() const { return Entries.Num(); }
+	int32 GetNumHits() const { return NumHits; }
+	int32 GetNumMisses() const { return Entries.Num(); }
+	// Misses that the fast parser couldn't handle and had to go through ImportText
+	int32 GetNumLegacyMisses() const { return NumLegacyMisses; }
+
+private:
+	TArray<FEntry> Entries;
+	TMap<FName, int32> EntryIndices;
+	int32 NumHits = 0;
+	int32 NumLegacyMisses = 0;
+};
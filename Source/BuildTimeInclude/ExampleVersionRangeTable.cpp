@@ -0,0 +1,172 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#include "ExampleVersionRangeTable.h"
+
+namespace ExampleVersionRangeTable
+{
+	static constexpr uint32 FileMagic = 0x54525845; // 'EXRT'
+	static constexpr uint32 FileVersion = 2;
+}
+
+uint64 FExampleVersionRangeTable::HashPrimaryAssetId(const FPrimaryAssetId& PrimaryAssetId)
+{
+	// Same bytes as lowercasing PrimaryAssetId.ToString(), but built on the stack
+	TStringBuilder<256> IdString;
+	PrimaryAssetId.PrimaryAssetType.GetName().AppendString(IdString);
+	IdString << TEXT(':');
+	PrimaryAssetId.PrimaryAssetName.AppendString(IdString);
+	for (TCHAR* Char = IdString.GetData(), *End = Char + IdString.Len(); Char < End; ++Char)
+	{
+		*Char = FChar::ToLower(*Char);
+	}
+
+	const FTCHARToUTF8 Utf8(IdString.GetData(), IdString.Len());
+	uint64 Hash = 0xcbf29ce484222325ull;
+	for (int32 Index = 0; Index < Utf8.Length(); ++Index)
+	{
+		Hash = (Hash ^ (uint8)Utf8.Get()[Index]) * 0x100000001b3ull;
+	}
+	return Hash;
+}
+
+bool FExampleVersionRangeTable::Build(TConstArrayView<FPrimaryAssetId> AssetIds, TConstArrayView<FExampleVersionRange> InRanges)
+{
+	check(AssetIds.Num() == InRanges.Num());
+	*this = FExampleVersionRangeTable();
+
+	struct FEntry
+	{
+		uint64 AssetIdHash;
+		uint16 RangeIndex;
+		int32 AssetIndex;
+	};
+	TMap<FExampleVersionRange, uint16> RangeToIndex;
+	TArray<FEntry> Entries;
+	Entries.Reserve(AssetIds.Num());
+	for (int32 Index = 0; Index < AssetIds.Num(); ++Index)
+	{
+		const uint16* ExistingIndex = RangeToIndex.Find(InRanges[Index]);
+		if (!ExistingIndex)
+		{
+			if (Ranges.Num() > MAX_uint16)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Version range table supports at most %d distinct version ranges."), MAX_uint16 + 1);
+				*this = FExampleVersionRangeTable();
+				return false;
+			}
+			ExistingIndex = &RangeToIndex.Add(InRanges[Index], (uint16)Ranges.Add(InRanges[Index]));
+		}
+		Entries.Add({ HashPrimaryAssetId(AssetIds[Index]), *ExistingIndex, Index });
+	}
+
+	Entries.Sort([](const FEntry& A, const FEntry& B) { return A.AssetIdHash < B.AssetIdHash; });
+	AssetIdHashes.Reserve(Entries.Num());
+	RangeIndices.Reserve(Entries.Num());
+	bool bHasCollisions = false;
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		if (Index > 0 && Entries[Index].AssetIdHash == Entries[Index - 1].AssetIdHash)
+		{
+			// Either entry's lookup would silently return the other one's range
+			const FPrimaryAssetId& AssetId = AssetIds[Entries[Index].AssetIndex];
+			const FPrimaryAssetId& PreviousAssetId = AssetIds[Entries[Index - 1].AssetIndex];
+			if (AssetId != PreviousAssetId)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Version range table: '%s' and '%s' have the same hash %016llx, rename one of them."),
+					*PreviousAssetId.ToString(), *AssetId.ToString(), Entries[Index].AssetIdHash);
+				bHasCollisions = true;
+			}
+			else if (Entries[Index].RangeIndex != Entries[Index - 1].RangeIndex)
+			{
+				UE_LOG(LogTemp, Error, TEXT("Version range table: '%s' is listed with different version ranges."), *AssetId.ToString());
+				bHasCollisions = true;
+			}
+			continue;
+		}
+		AssetIdHashes.Add(Entries[Index].AssetIdHash);
+		RangeIndices.Add(Entries[Index].RangeIndex);
+	}
+	if (bHasCollisions)
+	{
+		*this = FExampleVersionRangeTable();
+		return false;
+	}
+	BuildSlots();
+	return true;
+}
+
+void FExampleVersionRangeTable::BuildSlots()
+{
+	// At most half full, so probe sequences stay short
+	Slots.Init(INDEX_NONE, AssetIdHashes.Num() > 0 ? FMath::RoundUpToPowerOfTwo(AssetIdHashes.Num() * 2) : 0);
+	const uint32 SlotMask = Slots.Num() - 1;
+	for (int32 Index = 0; Index < AssetIdHashes.Num(); ++Index)
+	{
+		uint32 Slot = (uint32)AssetIdHashes[Index] & SlotMask;
+		while (Slots[Slot] != INDEX_NONE)
+		{
+			Slot = (Slot + 1) & SlotMask;
+		}
+		Slots[Slot] = Index;
+	}
+}
+
+int32 FExampleVersionRangeTable::FindIndex(uint64 AssetIdHash) const
+{
+	if (Slots.Num() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	const uint32 SlotMask = Slots.Num() - 1;
+	for (uint32 Slot = (uint32)AssetIdHash & SlotMask; Slots[Slot] != INDEX_NONE; Slot = (Slot + 1) & SlotMask)
+	{
+		if (AssetIdHashes[Slots[Slot]] == AssetIdHash)
+		{
+			return Slots[Slot];
+		}
+	}
+	return INDEX_NONE;
+}
+
+bool FExampleVersionRangeTable::TryGetVersionRange(const FPrimaryAssetId& PrimaryAssetId, FExampleVersionRange& OutRange) const
+{
+	const int32 Index = FindIndex(HashPrimaryAssetId(PrimaryAssetId));
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+	OutRange = Ranges[RangeIndices[Index]];
+	return true;
+}
+
+SIZE_T FExampleVersionRangeTable::GetAllocatedSize() const
+{
+	return AssetIdHashes.GetAllocatedSize() + RangeIndices.GetAllocatedSize() + Ranges.GetAllocatedSize() + Slots.GetAllocatedSize();
+}
+
+void FExampleVersionRangeTable::Serialize(FArchive& Ar)
+{
+	uint32 Magic = ExampleVersionRangeTable::FileMagic;
+	uint32 Version = ExampleVersionRangeTable::FileVersion;
+	Ar << Magic << Version;
+	if (Magic != ExampleVersionRangeTable::FileMagic || Version != ExampleVersionRangeTable::FileVersion)
+	{
+		Ar.SetError();
+		return;
+	}
+
+	// Bulk serialization, the arrays are plain integers. A slot table without free slots would never end a probe.
+	AssetIdHashes.BulkSerialize(Ar);
+	RangeIndices.BulkSerialize(Ar);
+	Slots.BulkSerialize(Ar);
+	Ar << Ranges;
+
+	if (Ar.IsLoading() && (AssetIdHashes.Num() != RangeIndices.Num() || !FMath::IsPowerOfTwo(FMath::Max(Slots.Num(), 1))
+		|| (AssetIdHashes.Num() > 0 && Slots.Num() <= AssetIdHashes.Num())
+		|| Slots.ContainsByPredicate([this](int32 Slot) { return Slot < INDEX_NONE || Slot >= AssetIdHashes.Num(); })
+		|| RangeIndices.ContainsByPredicate([this](uint16 RangeIndex) { return RangeIndex >= Ranges.Num(); })))
+	{
+		Ar.SetError();
+	}
+}
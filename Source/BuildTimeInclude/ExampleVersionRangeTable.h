@@ -0,0 +1,45 @@
+// Example project which build-time cooks actor classes, map actors, data assets and entire plugins based on game version number and build type.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExampleVersionRange.h"
+
+/**
+ * Version ranges of all shipped versioned primary assets, written at cook time as part of FExampleInclusionManifest and
+ * queried by the client instead of VersionRange tags, which the cooked asset registry strips (see CookedTagsDenyList in DefaultEngine.ini).
+ *
+ * Dense layout: a sorted array of 64-bit primary asset id hashes and a parallel array of 16-bit indices into the
+ * distinct ranges, plus an open addressing slot table over the hashes. Each asset costs 10 bytes plus up to 16 bytes
+ * of slots. A lookup hashes the characters of the id's two names in a stack buffer, without allocating, then probes
+ * the slots. FName indices aren't stable across processes, so they can't be the key of a table written at cook time.
+ * Everything is built at cook time, loading is a bulk copy.
+ */
+class BUILDTIMEINCLUDE_API FExampleVersionRangeTable
+{
+public:
+	// FNV-1a 64 of the lowercase UTF-8 "Type:Name" string, stable across processes and platforms
+	static uint64 HashPrimaryAssetId(const FPrimaryAssetId& PrimaryAssetId);
+
+	// AssetIds and Ranges must match by index. Fails on more than 65536 distinct ranges and on two different asset
+	// ids with the same hash. Listing the same asset id twice is fine if both ranges are equal.
+	bool Build(TConstArrayView<FPrimaryAssetId> AssetIds, TConstArrayView<FExampleVersionRange> Ranges);
+
+	bool TryGetVersionRange(const FPrimaryAssetId& PrimaryAssetId, FExampleVersionRange& OutRange) const;
+	int32 Num() const { return AssetIdHashes.Num(); }
+	int32 GetNumDistinctRanges() const { return Ranges.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+	void Serialize(FArchive& Ar);
+
+private:
+	void BuildSlots();
+	int32 FindIndex(uint64 AssetIdHash) const;
+
+	// Sorted ascending, RangeIndices matches by index
+	TArray<uint64> AssetIdHashes;
+	TArray<uint16> RangeIndices;
+	TArray<FExampleVersionRange> Ranges;
+	// Power of two sized, index into AssetIdHashes or INDEX_NONE. Probed linearly from the hash's low bits.
+	TArray<int32> Slots;
+};
@@ -22,6 +22,7 @@ public class BuildTimeIncludeEditorTarget : TargetRules
         // Set to false if you don't need the version checking to be strict.
         bWarningsAsErrors = true;
 
-        BuildTimeIncludeTarget.ConfigureGameFeaturePlugins(Target, Logger, ProjectFile, DisablePlugins, EnablePlugins);
+        BuildTimeIncludeTarget.ConfigureGameFeaturePlugins(Target, Type, Logger, ProjectFile, DisablePlugins, EnablePlugins);
+        BuildTimeIncludeTarget.WriteReleaseVersionHeader(Target, Type, Logger, ProjectFile);
     }
 }